@@ -0,0 +1,421 @@
+#include "histogram.h"
+#include "kv.pb.h"
+#include "log.h"
+#include "protocol.h"
+#include "storage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace NLogging;
+using namespace NMetrics;
+using namespace NProtocol;
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// requests per commit in the sync benchmarks, the server's default
+constexpr size_t commit_batch = 256;
+// recv() size the framing benchmark feeds the buffer with
+constexpr size_t recv_size = 16 * 1024;
+
+struct BenchEnv
+{
+    // scratch directory, wiped before and after every benchmark
+    std::string dir = "bench_data";
+    // operations per benchmark
+    size_t ops = 200000;
+    // keys of the synthetic recovery datasets
+    size_t recovery_keys = 1000000;
+    // bytes written for the segment-crossing reads
+    uint64_t segment_bytes = 160ULL << 20;
+
+    BenchEnv()
+    {
+        if (auto value = std::getenv("BENCH_DIR")) {
+            dir = value;
+        }
+
+        if (auto value = std::getenv("BENCH_OPS")) {
+            ops = std::max(1L, atol(value));
+        }
+
+        if (auto value = std::getenv("BENCH_RECOVERY_KEYS")) {
+            recovery_keys = std::max(1L, atol(value));
+        }
+
+        if (auto value = std::getenv("BENCH_SEGMENT_MB")) {
+            segment_bytes = std::max(1L, atol(value)) << 20;
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+using Clock = std::chrono::steady_clock;
+
+double seconds_since(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// "name: N ops in X ms, Y ns/op, Z ops/s[, W MiB/s]"
+void report(const std::string& name, uint64_t ops, double seconds, uint64_t bytes = 0)
+{
+    std::cout << std::fixed << std::setprecision(1)
+        << name << ": " << ops << " ops in " << seconds * 1000 << " ms, "
+        << seconds * 1e9 / std::max<uint64_t>(ops, 1) << " ns/op, "
+        << std::setprecision(0) << ops / seconds << " ops/s";
+    if (bytes) {
+        std::cout << std::setprecision(1) << ", " << bytes / seconds / (1 << 20) << " MiB/s";
+    }
+    std::cout << std::endl;
+}
+
+// "name: X ms", for one-off events
+void report_time(const std::string& name, double seconds)
+{
+    std::cout << std::fixed << std::setprecision(1)
+        << name << ": " << seconds * 1000 << " ms" << std::endl;
+}
+
+void report(const std::string& name, const Histogram& latency_us)
+{
+    std::cout << name << " latency_us: ";
+    latency_us.print(std::cout);
+    std::cout << std::endl;
+}
+
+std::string make_key(uint64_t i)
+{
+    return "key" + std::to_string(i);
+}
+
+void reset_dir(const std::string& dir)
+{
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+using Benchmark = std::function<void(const BenchEnv& env, const std::string& prefix)>;
+
+void bench_map(const BenchEnv& env, const std::string& prefix)
+{
+    PersistentStorage map(prefix + "data");
+    std::vector<std::string> keys(env.ops);
+    for (size_t i = 0; i < env.ops; ++i) {
+        keys[i] = make_key(i);
+    }
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < env.ops; ++i) {
+        map.put(keys[i], i);
+    }
+    report("map.put", env.ops, seconds_since(start));
+
+    start = Clock::now();
+    map.sync();
+    report_time("map.sync_all", seconds_since(start));
+
+    // commit_batch puts per sync, as the group commit does
+    Histogram sync_latency;
+    start = Clock::now();
+    for (size_t i = 0; i < env.ops; i += commit_batch) {
+        for (size_t j = i; j < std::min(env.ops, i + commit_batch); ++j) {
+            map.put(keys[j], j + 1);
+        }
+        const auto sync_start = Clock::now();
+        map.sync();
+        sync_latency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - sync_start).count());
+    }
+    report("map.put_sync" + std::to_string(commit_batch), env.ops, seconds_since(start));
+    report("map.sync" + std::to_string(commit_batch), sync_latency);
+
+    std::mt19937_64 rng(42);
+    uint64_t found = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < env.ops; ++i) {
+        uint64_t value;
+        found += map.find(keys[rng() % env.ops], &value);
+    }
+    report("map.find_hit", env.ops, seconds_since(start));
+    VERIFY(found == env.ops, "lost keys");
+
+    std::vector<std::string> missing(env.ops);
+    for (size_t i = 0; i < env.ops; ++i) {
+        missing[i] = make_key(env.ops + i);
+    }
+    start = Clock::now();
+    for (size_t i = 0; i < env.ops; ++i) {
+        uint64_t value;
+        found += map.find(missing[i], &value);
+    }
+    report("map.find_miss", env.ops, seconds_since(start));
+    std::cout << std::setprecision(2) << "map.find_miss filtered: "
+        << map.filtered_count() * 100.0 / env.ops << "%" << std::endl;
+}
+
+// Puts and uncached random gets of values of one size, compressed with
+// `compression`: then the values are JSON-ish, repetitive but not constant.
+// JSON-like bytes that LZ4 compresses well if `compressible`, else 'v's
+std::string make_value(size_t size, bool compressible)
+{
+    std::string value(size, 'v');
+    if (compressible) {
+        for (size_t i = 0; i < size; ++i) {
+            value[i] = "{\"id\": 12345, \"name\": \"value\", \"tags\": [1, 2, 3]}, "[i % 53];
+        }
+    }
+    return value;
+}
+
+void bench_storage_size(const BenchEnv& env, const std::string& prefix, size_t value_size, bool compression = false)
+{
+    // at most 256 MiB per size
+    const size_t ops = std::max<size_t>(1, std::min(env.ops, (256 << 20) / value_size));
+    const auto value = make_value(value_size, compression);
+    const auto name = "storage." + std::to_string(value_size) + (compression ? ".compressed" : "");
+
+    StorageOptions options;
+    options.compression = compression;
+    Storage storage(prefix, options);
+    std::vector<std::string> keys(ops);
+    for (size_t i = 0; i < ops; ++i) {
+        keys[i] = make_key(i);
+    }
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < ops; ++i) {
+        storage.put(keys[i], value);
+        if ((i + 1) % commit_batch == 0) {
+            storage.sync();
+        }
+    }
+    storage.sync();
+    report(name + ".put_sync" + std::to_string(commit_batch), ops, seconds_since(start), ops * value_size);
+
+    std::mt19937_64 rng(42);
+    std::string read;
+    start = Clock::now();
+    for (size_t i = 0; i < ops; ++i) {
+        VERIFY(storage.get(keys[rng() % ops], &read), "lost key");
+    }
+    report(name + ".get", ops, seconds_since(start), ops * value_size);
+    if (compression) {
+        std::cout << std::setprecision(1) << name << ".stored_percent: "
+            << 100.0 * (storage.usage().total_bytes) / (storage.usage().total_bytes
+                + storage.usage().compression_saved_bytes) << "%" << std::endl;
+    }
+}
+
+void bench_storage(const BenchEnv& env, const std::string& prefix)
+{
+    for (const size_t value_size: {16, 128, 1024, 16384}) {
+        reset_dir(env.dir);
+        bench_storage_size(env, prefix, value_size);
+    }
+    for (const size_t value_size: {1024, 16384}) {
+        reset_dir(env.dir);
+        bench_storage_size(env, prefix, value_size, true);
+    }
+
+    // the compressed reads served by the value cache, which only keeps values
+    // it saves decompressing
+    reset_dir(env.dir);
+    StorageOptions options;
+    options.compression = true;
+    options.cache_size = 64 << 20;
+    Storage storage(prefix, options);
+    const auto value = make_value(1024, true);
+    const size_t keys = std::min<size_t>(env.ops, 50000);
+    for (size_t i = 0; i < keys; ++i) {
+        storage.put(make_key(i), value);
+    }
+    storage.sync();
+
+    std::string read;
+    for (size_t i = 0; i < keys; ++i) {
+        storage.get(make_key(i), &read);
+    }
+
+    std::vector<std::string> lookups(env.ops);
+    std::mt19937_64 rng(42);
+    for (auto& key: lookups) {
+        key = make_key(rng() % keys);
+    }
+
+    const auto start = Clock::now();
+    for (const auto& key: lookups) {
+        storage.get(key, &read);
+    }
+    report("storage.1024.compressed.get_cached", env.ops, seconds_since(start));
+}
+
+// Random reads over several sealed segments, then reopening them.
+void bench_segments(const BenchEnv& env, const std::string& prefix)
+{
+    const std::string value(4096, 's');
+    const size_t count = env.segment_bytes / value.size();
+    {
+        Storage storage(prefix, StorageOptions{});
+        for (size_t i = 0; i < count; ++i) {
+            storage.put(make_key(i), value);
+            if ((i + 1) % commit_batch == 0) {
+                storage.sync();
+            }
+        }
+        storage.sync();
+
+        std::mt19937_64 rng(42);
+        std::string read;
+        const auto start = Clock::now();
+        for (size_t i = 0; i < env.ops; ++i) {
+            VERIFY(storage.get(make_key(rng() % count), &read), "lost key");
+        }
+        report("segments." + std::to_string(storage.usage().segments) + ".get",
+            env.ops, seconds_since(start), env.ops * value.size());
+    }
+
+    const auto start = Clock::now();
+    Storage storage(prefix, StorageOptions{});
+    report_time("segments.reopen", seconds_since(start));
+}
+
+// Framing a stream of PUT requests as the event loops do, and serializing it.
+void bench_framing(const BenchEnv& env, const std::string& /*prefix*/)
+{
+    std::vector<std::string> messages(1024);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        NProto::TPutRequest request;
+        request.set_request_id(i);
+        request.set_key(make_key(i));
+        request.set_value(std::string(100, 'e'));
+        serialize(PUT_REQUEST, request, &messages[i]);
+    }
+
+    std::string stream;
+    for (size_t i = 0; i < env.ops; ++i) {
+        stream += messages[i % messages.size()];
+    }
+
+    MessageBuffer buffer;
+    size_t framed = 0;
+    auto start = Clock::now();
+    for (size_t offset = 0; offset < stream.size(); ) {
+        auto [tail, size] = buffer.tail();
+        size = std::min({size, recv_size, stream.size() - offset});
+        memcpy(tail, stream.data() + offset, size);
+        buffer.commit(size);
+        offset += size;
+
+        char type;
+        std::string_view message;
+        while (buffer.next(&type, &message)) {
+            ++framed;
+        }
+    }
+    report("framing.next", framed, seconds_since(start), stream.size());
+    VERIFY(framed == env.ops, "lost messages");
+
+    NProto::TPutRequest request;
+    request.set_key(make_key(0));
+    request.set_value(std::string(100, 'e'));
+    std::string out;
+    start = Clock::now();
+    for (size_t i = 0; i < env.ops; ++i) {
+        request.set_request_id(i);
+        serialize(PUT_REQUEST, request, &out);
+    }
+    report("framing.serialize", env.ops, seconds_since(start));
+}
+
+// Startup of a map of recovery_keys keys: once replaying all of them from
+// the journal, as after a crash before the first checkpoint, then again
+// from the checkpointed index.
+void bench_recovery(const BenchEnv& env, const std::string& prefix)
+{
+    const auto name = "recovery." + std::to_string(env.recovery_keys);
+    {
+        FILE* journal = fopen((prefix + "data.log").c_str(), "wb");
+        VERIFY(journal, "failed to create the journal");
+        std::string records;
+        append_journal_header(&records);
+        for (uint64_t i = 0; i < env.recovery_keys; ++i) {
+            append_journal_record(&records, make_key(i), i);
+            if (records.size() > (1 << 20)) {
+                VERIFY(fwrite(records.data(), 1, records.size(), journal) == records.size(),
+                    "failed to write the journal");
+                records.clear();
+            }
+        }
+        VERIFY(fwrite(records.data(), 1, records.size(), journal) == records.size(),
+            "failed to write the journal");
+        fclose(journal);
+    }
+
+    {
+        const auto start = Clock::now();
+        PersistentStorage map(prefix + "data");
+        report(name + ".replay", env.recovery_keys, seconds_since(start));
+
+        uint64_t value;
+        VERIFY(map.find(make_key(env.recovery_keys - 1), &value), "lost key");
+    }
+
+    const auto start = Clock::now();
+    PersistentStorage map(prefix + "data");
+    report_time(name + ".reopen", seconds_since(start));
+}
+
+}   // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, const char** argv)
+{
+    const BenchEnv env;
+    const std::vector<std::pair<std::string, Benchmark>> benchmarks = {
+        {"map", bench_map},
+        {"storage", bench_storage},
+        {"segments", bench_segments},
+        {"framing", bench_framing},
+        {"recovery", bench_recovery},
+    };
+
+    std::vector<std::string> selected(argv + 1, argv + argc);
+    for (const auto& name: selected) {
+        if (std::none_of(benchmarks.begin(), benchmarks.end(),
+                [&] (const auto& b) { return b.first == name; }))
+        {
+            LOG_ERROR_S("unknown benchmark " << name);
+            return 1;
+        }
+    }
+
+    for (const auto& [name, benchmark]: benchmarks) {
+        if (!selected.empty()
+                && std::find(selected.begin(), selected.end(), name) == selected.end())
+        {
+            continue;
+        }
+
+        reset_dir(env.dir);
+        benchmark(env, env.dir + "/");
+    }
+    std::filesystem::remove_all(env.dir);
+
+    return 0;
+}
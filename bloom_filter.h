@@ -0,0 +1,66 @@
+#ifndef LOCAL_STORAGE_BLOOM_FILTER_H
+#define LOCAL_STORAGE_BLOOM_FILTER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Blocked Bloom filter over 64-bit key hashes: all bits of a key are set in
+// one 64-byte block, so a lookup touches a single cache line. Sized for
+// `capacity` keys at about 1% false positives; past that it still works, just
+// with more of them. Lookups may run concurrently with add(), adds must be
+// serialized by the caller.
+class BloomFilter {
+public:
+    explicit BloomFilter(uint64_t capacity) : keys_capacity(capacity) {
+        uint64_t blocks = 1;
+        while (blocks * block_bits < capacity * bits_per_key)
+            blocks *= 2;
+        block_mask = blocks - 1;
+        words = std::make_unique<std::atomic<uint64_t>[]>(blocks * block_words);
+        for (uint64_t i = 0; i < blocks * block_words; i++)
+            words[i].store(0, std::memory_order_relaxed);
+    }
+
+    void add(uint64_t hash) {
+        std::atomic<uint64_t> *block = &words[(hash & block_mask) * block_words];
+        uint64_t bits = mix(hash);
+        for (uint64_t i = 0; i < probes; i++, bits >>= 9)
+            block[(bits >> 6) & (block_words - 1)].fetch_or(1ULL << (bits & 63), std::memory_order_relaxed);
+    }
+
+    bool may_contain(uint64_t hash) const {
+        const std::atomic<uint64_t> *block = &words[(hash & block_mask) * block_words];
+        uint64_t bits = mix(hash);
+        for (uint64_t i = 0; i < probes; i++, bits >>= 9)
+            if (!(block[(bits >> 6) & (block_words - 1)].load(std::memory_order_relaxed) & (1ULL << (bits & 63))))
+                return false;
+        return true;
+    }
+
+    uint64_t capacity() const {
+        return keys_capacity;
+    }
+
+private:
+    static constexpr uint64_t bits_per_key = 10;
+    static constexpr uint64_t probes = 7;
+    static constexpr uint64_t block_words = 8;
+    static constexpr uint64_t block_bits = block_words * 64;
+
+    uint64_t keys_capacity;
+    uint64_t block_mask = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> words;
+
+    // The low bits of the hash pick the block (and the hash index bucket),
+    // the bits inside it come from a remix of the whole hash. 7 probes of 9
+    // bits each: 3 for the word, 6 for the bit.
+    static uint64_t mix(uint64_t hash) {
+        hash += 0x9e3779b97f4a7c15ULL;
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        return hash ^ (hash >> 31);
+    }
+};
+
+#endif //LOCAL_STORAGE_BLOOM_FILTER_H
@@ -0,0 +1,160 @@
+#ifndef LOCAL_STORAGE_CACHE_H
+#define LOCAL_STORAGE_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Memory-bounded cache of values keyed by their log offset. Records are never
+// rewritten in place, so a cached offset can't go stale: entries for
+// overwritten records only need to be dropped to free memory, not for
+// correctness. Sharded by offset, each shard evicts with CLOCK.
+class ValueCache {
+public:
+    explicit ValueCache(uint64_t capacity_bytes) {
+        for (auto &shard : shards) {
+            shard = std::make_unique<Shard>();
+            shard->capacity = capacity_bytes / shard_count;
+        }
+    }
+
+    bool find(uint64_t offset, std::string *value) {
+        if (disabled())
+            return false;
+        Shard &shard = shard_for(offset);
+        {
+            std::lock_guard<std::mutex> g(shard.mutex);
+            auto it = shard.index.find(offset);
+            if (it != shard.index.end()) {
+                Entry &e = shard.entries[it->second];
+                e.referenced = true;
+                *value = e.value;
+                hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void insert(uint64_t offset, const std::string &value) {
+        if (disabled())
+            return;
+        Shard &shard = shard_for(offset);
+        uint64_t size = entry_size(value);
+        if (size > shard.capacity)
+            return;
+
+        std::lock_guard<std::mutex> g(shard.mutex);
+        if (shard.index.count(offset))
+            return;
+        while (shard.bytes + size > shard.capacity)
+            evict(shard);
+
+        size_t slot;
+        if (!shard.free_slots.empty()) {
+            slot = shard.free_slots.back();
+            shard.free_slots.pop_back();
+        } else {
+            slot = shard.entries.size();
+            shard.entries.emplace_back();
+        }
+        Entry &e = shard.entries[slot];
+        e.offset = offset;
+        e.value = value;
+        e.used = true;
+        e.referenced = false;
+        shard.index[offset] = slot;
+        shard.bytes += size;
+    }
+
+    void erase(uint64_t offset) {
+        if (disabled())
+            return;
+        Shard &shard = shard_for(offset);
+        std::lock_guard<std::mutex> g(shard.mutex);
+        auto it = shard.index.find(offset);
+        if (it != shard.index.end())
+            remove(shard, it->second);
+    }
+
+    uint64_t hit_count() const {
+        return hits.load(std::memory_order_relaxed);
+    }
+
+    uint64_t miss_count() const {
+        return misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t shard_count = 16;
+    // rough per-entry bookkeeping: slot, index node, string header
+    static constexpr uint64_t entry_overhead = 96;
+
+    struct Entry {
+        uint64_t offset = 0;
+        std::string value;
+        bool used = false;
+        bool referenced = false;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        uint64_t capacity = 0;
+        uint64_t bytes = 0;
+        std::vector<Entry> entries;
+        std::vector<size_t> free_slots;
+        std::unordered_map<uint64_t, size_t> index;
+        size_t hand = 0;
+    };
+
+    std::unique_ptr<Shard> shards[shard_count];
+    std::atomic<uint64_t> hits{0}, misses{0};
+
+    bool disabled() const {
+        return shards[0]->capacity == 0;
+    }
+
+    Shard &shard_for(uint64_t offset) {
+        // offsets are record-aligned, mix them before picking a shard
+        return *shards[(offset * 0x9e3779b97f4a7c15ULL) >> 60];
+    }
+
+    static uint64_t entry_size(const std::string &value) {
+        return value.size() + entry_overhead;
+    }
+
+    // CLOCK: sweeps the hand over the slots, giving referenced entries a
+    // second chance, and evicts the first unreferenced one.
+    static void evict(Shard &shard) {
+        while (true) {
+            if (shard.hand >= shard.entries.size())
+                shard.hand = 0;
+            Entry &e = shard.entries[shard.hand];
+            size_t slot = shard.hand++;
+            if (!e.used)
+                continue;
+            if (e.referenced) {
+                e.referenced = false;
+                continue;
+            }
+            remove(shard, slot);
+            return;
+        }
+    }
+
+    static void remove(Shard &shard, size_t slot) {
+        Entry &e = shard.entries[slot];
+        shard.bytes -= entry_size(e.value);
+        shard.index.erase(e.offset);
+        e.used = false;
+        std::string().swap(e.value);
+        shard.free_slots.push_back(slot);
+    }
+};
+
+#endif //LOCAL_STORAGE_CACHE_H
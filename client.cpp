@@ -1,15 +1,25 @@
+#include "histogram.h"
 #include "kv.pb.h"
 #include "log.h"
 #include "protocol.h"
 #include "rpc.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <cstring>
-#include <sstream>
+#include <iostream>
+#include <numeric>
+#include <random>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <errno.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 #include <arpa/inet.h>
@@ -29,6 +39,451 @@ namespace {
 
 constexpr int max_events = 32;
 constexpr int timeout = 1000;
+// keys per request in the mput and mget stages
+constexpr int multi_batch_size = 16;
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Load generator mode, enabled by LOAD_CONNECTIONS: instead of checking
+// responses, the stages are replayed as fast as the settings allow and
+// reported as throughput and latency percentiles.
+struct LoadEnv
+{
+    // connections in total, 0 runs the usual verifying client
+    size_t connections = 0;
+    // client threads, each with its share of the connections
+    size_t threads = 1;
+    // requests in flight per connection (closed loop)...
+    size_t pipeline = 16;
+    // ...or, if set, the total request rate to send at regardless of
+    // responses (open loop); latency is then measured from the scheduled
+    // send time, so a stalled server isn't hidden by a stalled client
+    double rate = 0;
+    // keys are drawn from [0, keys), 0 means the request count
+    size_t keys = 0;
+    // keys are padded to at least this many bytes
+    size_t key_size = 0;
+    // value sizes are drawn uniformly from [value_size_min, value_size_max]
+    size_t value_size_min = 100;
+    size_t value_size_max = 100;
+    // "uniform" or "zipf"
+    bool zipf = false;
+    double zipf_theta = 0.99;
+
+    LoadEnv()
+    {
+        if (auto value = std::getenv("LOAD_CONNECTIONS")) {
+            connections = std::max(0, atoi(value));
+        }
+
+        if (auto value = std::getenv("LOAD_THREADS")) {
+            threads = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("LOAD_PIPELINE")) {
+            pipeline = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("LOAD_RATE")) {
+            rate = std::max(0.0, atof(value));
+        }
+
+        if (auto value = std::getenv("LOAD_KEYS")) {
+            keys = std::max(0, atoi(value));
+        }
+
+        if (auto value = std::getenv("LOAD_KEY_SIZE")) {
+            key_size = std::max(0, atoi(value));
+        }
+
+        // "N" or "MIN-MAX"
+        if (auto value = std::getenv("LOAD_VALUE_SIZE")) {
+            value_size_min = std::max(0, atoi(value));
+            const char* dash = strchr(value, '-');
+            value_size_max = dash ? std::max<size_t>(value_size_min, atoi(dash + 1)) : value_size_min;
+        }
+
+        if (auto value = std::getenv("LOAD_DISTRIBUTION")) {
+            if (std::string(value) == "zipf") {
+                zipf = true;
+            } else if (std::string(value) != "uniform") {
+                abort();
+            }
+        }
+
+        if (auto value = std::getenv("LOAD_ZIPF_THETA")) {
+            zipf_theta = atof(value);
+        }
+
+        threads = std::min(threads, std::max<size_t>(connections, 1));
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Zipfian key choice as in YCSB (Gray et al., "Quickly generating
+// billion-record synthetic databases"), with the ranks scrambled so that the
+// hot keys don't all sit next to each other: rank r is key r * multiplier mod
+// n, a permutation of [0, n) since the multiplier is coprime with n.
+class ZipfGenerator
+{
+private:
+    uint64_t n;
+    double theta;
+    double alpha;
+    double zetan;
+    double eta;
+    uint64_t multiplier;
+
+public:
+    ZipfGenerator(uint64_t n, double theta)
+        : n(n)
+        , theta(theta)
+        , alpha(1 / (1 - theta))
+        , zetan(zeta(n, theta))
+        , eta((1 - std::pow(2.0 / n, 1 - theta)) / (1 - zeta(2, theta) / zetan))
+        , multiplier(coprime_multiplier(n))
+    {
+    }
+
+    template <typename TRandom>
+    uint64_t next(TRandom& random)
+    {
+        const double u = std::uniform_real_distribution<double>(0, 1)(random);
+        const double uz = u * zetan;
+        uint64_t rank;
+        if (uz < 1) {
+            rank = 0;
+        } else if (uz < 1 + std::pow(0.5, theta)) {
+            rank = 1;
+        } else {
+            rank = std::min<uint64_t>(n - 1, n * std::pow(eta * u - eta + 1, alpha));
+        }
+
+        return static_cast<unsigned __int128>(rank) * multiplier % n;
+    }
+
+private:
+    // the first number coprime with n from n / golden ratio on, which spreads
+    // consecutive ranks over the whole key range
+    static uint64_t coprime_multiplier(uint64_t n)
+    {
+        uint64_t multiplier = std::max<uint64_t>(1, n * 0.6180339887498949);
+        while (std::gcd(multiplier, n) != 1) {
+            ++multiplier;
+        }
+        return multiplier;
+    }
+
+    static double zeta(uint64_t n, double theta)
+    {
+        double sum = 0;
+        for (uint64_t i = 1; i <= n; ++i) {
+            sum += 1 / std::pow(i, theta);
+        }
+        return sum;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct LoadConnection
+{
+    SocketState state;
+    // request_id -> (scheduled) send time
+    std::unordered_map<uint64_t, std::chrono::steady_clock::time_point> in_flight;
+};
+
+struct LoadResult
+{
+    NMetrics::Histogram latency_us;
+    uint64_t errors = 0;
+};
+
+int connect_to(int port)
+{
+    int socketfd = socket(AF_INET, SOCK_STREAM, 0);
+    if (socketfd == -1) {
+        return -1;
+    }
+
+    struct sockaddr_in dest;
+    bzero(&dest, sizeof(dest));
+    dest.sin_family = AF_INET;
+    dest.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &dest.sin_addr.s_addr);
+
+    if (connect(socketfd, (struct sockaddr*)&dest, sizeof(dest)) != 0
+            || fcntl(socketfd, F_SETFL, fcntl(socketfd, F_GETFL, 0) | O_NONBLOCK) == -1)
+    {
+        LOG_PERROR("failed to connect");
+        close(socketfd);
+        return -1;
+    }
+
+    return socketfd;
+}
+
+// Runs `requests` requests of the stage over the thread's connections.
+void run_load_thread(
+    const LoadEnv& env,
+    const std::string& stage,
+    int port,
+    size_t connection_count,
+    uint64_t requests,
+    uint64_t key_count,
+    uint64_t seed,
+    LoadResult* result)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937_64 random(seed);
+    std::unique_ptr<ZipfGenerator> zipf;
+    if (env.zipf) {
+        zipf = std::make_unique<ZipfGenerator>(key_count, env.zipf_theta);
+    }
+
+    auto make_key = [&] {
+        const auto i = zipf
+            ? zipf->next(random)
+            : std::uniform_int_distribution<uint64_t>(0, key_count - 1)(random);
+        auto key = "key" + std::to_string(i);
+        if (key.size() < env.key_size) {
+            key.append(env.key_size - key.size(), '_');
+        }
+        return key;
+    };
+
+    auto make_value = [&] {
+        const auto size = std::uniform_int_distribution<size_t>(
+            env.value_size_min, env.value_size_max)(random);
+        return std::string(size, 'v');
+    };
+
+    int epollfd = epoll_create1(0);
+    std::vector<std::unique_ptr<LoadConnection>> connections;
+    std::unordered_map<int, LoadConnection*> by_fd;
+    for (size_t i = 0; i < connection_count; ++i) {
+        const int fd = connect_to(port);
+        if (fd == -1) {
+            result->errors += requests;
+            close(epollfd);
+            return;
+        }
+
+        connections.push_back(std::make_unique<LoadConnection>());
+        connections.back()->state.fd = fd;
+        by_fd[fd] = connections.back().get();
+
+        struct epoll_event event;
+        event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        event.data.fd = fd;
+        epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &event);
+    }
+
+    uint64_t request_id = 0;
+    auto enqueue = [&] (LoadConnection& conn, Clock::time_point sent) {
+        auto message = conn.state.acquire_buffer();
+        const auto id = request_id++;
+        if (stage == "put") {
+            NProto::TPutRequest request;
+            request.set_request_id(id);
+            request.set_key(make_key());
+            request.set_value(make_value());
+            serialize(PUT_REQUEST, request, &message);
+        } else if (stage == "get") {
+            NProto::TGetRequest request;
+            request.set_request_id(id);
+            request.set_key(make_key());
+            serialize(GET_REQUEST, request, &message);
+        } else if (stage == "put2") {
+            NProto::TPutNumberRequest request;
+            request.set_request_id(id);
+            request.set_key(make_key());
+            request.set_offset(random());
+            serialize(PUT_NUMBER_REQUEST, request, &message);
+        } else if (stage == "get2") {
+            NProto::TGetNumberRequest request;
+            request.set_request_id(id);
+            request.set_key(make_key());
+            serialize(GET_NUMBER_REQUEST, request, &message);
+        } else if (stage == "mput") {
+            NProto::TMultiPutRequest request;
+            request.set_request_id(id);
+            for (int j = 0; j < ::multi_batch_size; ++j) {
+                auto* kv = request.add_kvs();
+                kv->set_key(make_key());
+                kv->set_value(make_value());
+            }
+            serialize(MULTI_PUT_REQUEST, request, &message);
+        } else {
+            NProto::TMultiGetRequest request;
+            request.set_request_id(id);
+            for (int j = 0; j < ::multi_batch_size; ++j) {
+                request.add_keys(make_key());
+            }
+            serialize(MULTI_GET_REQUEST, request, &message);
+        }
+
+        conn.in_flight[id] = sent;
+        conn.state.queue_output(std::move(message));
+    };
+
+    // every response type starts with request_id = 1
+    NProto::TPutResponse response_id;
+    uint64_t completed = 0;
+    const Handler handler = [&] (
+        int fd,
+        char /*message_type*/,
+        std::string_view response,
+        std::string* /*output*/)
+    {
+        auto& conn = *by_fd.at(fd);
+        if (!response_id.ParseFromArray(response.data(), response.size())) {
+            ++result->errors;
+            return;
+        }
+
+        auto it = conn.in_flight.find(response_id.request_id());
+        if (it == conn.in_flight.end()) {
+            ++result->errors;
+            return;
+        }
+
+        result->latency_us.record(std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - it->second).count());
+        conn.in_flight.erase(it);
+        ++completed;
+    };
+
+    const bool open_loop = env.rate > 0;
+    const auto interval = open_loop
+        ? std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(env.threads / env.rate))
+        : Clock::duration::zero();
+    auto next_send = Clock::now();
+    uint64_t issued = 0;
+    size_t next_connection = 0;
+
+    std::array<struct epoll_event, ::max_events> events;
+    while (completed + result->errors < requests) {
+        const auto now = Clock::now();
+        std::vector<LoadConnection*> touched;
+        if (open_loop) {
+            while (issued < requests && next_send <= now) {
+                auto& conn = *connections[next_connection++ % connections.size()];
+                enqueue(conn, next_send);
+                touched.push_back(&conn);
+                next_send += interval;
+                ++issued;
+            }
+        } else {
+            for (auto& conn: connections) {
+                while (issued < requests && conn->in_flight.size() < env.pipeline) {
+                    enqueue(*conn, now);
+                    ++issued;
+                }
+                touched.push_back(conn.get());
+            }
+        }
+
+        for (auto* conn: touched) {
+            if (!process_output(conn->state)) {
+                LOG_ERROR("failed to send request");
+                result->errors += requests;
+                break;
+            }
+        }
+
+        int wait_ms = ::timeout;
+        if (open_loop && issued < requests) {
+            wait_ms = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::milliseconds>(
+                next_send - Clock::now()).count());
+        }
+
+        const int n = epoll_wait(epollfd, events.data(), ::max_events, wait_ms);
+        for (int i = 0; i < n; ++i) {
+            auto& conn = *by_fd.at(events[i].data.fd);
+            if (events[i].events & EPOLLIN) {
+                if (!process_input(conn.state, handler)) {
+                    LOG_ERROR("failed to read response");
+                    result->errors += requests;
+                    break;
+                }
+            }
+
+            if (events[i].events & EPOLLOUT) {
+                process_output(conn.state);
+            }
+        }
+    }
+
+    for (auto& conn: connections) {
+        close(conn->state.fd);
+    }
+    close(epollfd);
+}
+
+int run_load(
+    const LoadEnv& env,
+    int port,
+    uint64_t max_requests,
+    const std::vector<std::string>& stages)
+{
+    const std::vector<std::string> known_stages = {"put", "get", "put2", "get2", "mput", "mget"};
+    const uint64_t key_count = env.keys ? env.keys : std::max<uint64_t>(max_requests, 1);
+
+    for (const auto& stage: stages) {
+        if (std::find(known_stages.begin(), known_stages.end(), stage) == known_stages.end()) {
+            LOG_ERROR_S("unknown stage " << stage);
+            return 1;
+        }
+
+        std::vector<LoadResult> results(env.threads);
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < env.threads; ++i) {
+            const size_t connections = env.connections / env.threads
+                + (i < env.connections % env.threads);
+            const uint64_t requests = max_requests / env.threads
+                + (i < max_requests % env.threads);
+            threads.emplace_back(
+                run_load_thread,
+                std::cref(env),
+                std::cref(stage),
+                port,
+                connections,
+                requests,
+                key_count,
+                i + 1,
+                &results[i]);
+        }
+
+        for (auto& thread: threads) {
+            thread.join();
+        }
+        const auto elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+        LoadResult total;
+        for (const auto& result: results) {
+            total.latency_us.merge(result.latency_us);
+            total.errors += result.errors;
+        }
+
+        std::cout << stage << ": " << total.latency_us.count() << " requests in "
+            << elapsed << " s, " << static_cast<uint64_t>(total.latency_us.count() / elapsed)
+            << " requests/s, " << total.errors << " errors, latency us ";
+        total.latency_us.print(std::cout);
+        std::cout << std::endl;
+
+        if (total.errors) {
+            return 2;
+        }
+    }
+
+    return 0;
+}
 
 }   // namespace
 
@@ -56,6 +511,11 @@ int main(int argc, const char** argv) {
         stages = {"put", "get"};
     }
 
+    const LoadEnv load_env;
+    if (load_env.connections) {
+        return ::run_load(load_env, port, max_requests, stages);
+    }
+
     /*
      * socket initialization
      */
@@ -115,37 +575,33 @@ int main(int argc, const char** argv) {
 
     auto stage_put_number = [&] () {
         for (int i = 0; i < max_requests; ++i) {
-            std::stringstream key;
-            key << "key" << i;
+            const auto key = "key" + std::to_string(i);
 
             NProto::TPutNumberRequest put_request;
             put_request.set_request_id(request_count++);
-            put_request.set_key(key.str());
+            put_request.set_key(key);
             put_request.set_offset(generate_data(i));
 
-            std::stringstream message;
-            serialize_header(PUT_NUMBER_REQUEST, put_request.ByteSizeLong(), message);
-            put_request.SerializeToOstream(&message);
+            std::string message;
+            serialize(PUT_NUMBER_REQUEST, put_request, &message);
 
-            state.output_queue.push_back(message.str());
+            state.queue_output(std::move(message));
         }
     };
 
     auto stage_put = [&] () {
         for (int i = 0; i < max_requests; ++i) {
-            std::stringstream key;
-            key << "key" << i;
+            const auto key = "key" + std::to_string(i);
 
             NProto::TPutRequest put_request;
             put_request.set_request_id(request_count++);
-            put_request.set_key(key.str());
+            put_request.set_key(key);
             put_request.set_value(generate_data2(i));
 
-            std::stringstream message;
-            serialize_header(PUT_REQUEST, put_request.ByteSizeLong(), message);
-            put_request.SerializeToOstream(&message);
+            std::string message;
+            serialize(PUT_REQUEST, put_request, &message);
 
-            state.output_queue.push_back(message.str());
+            state.queue_output(std::move(message));
         }
     };
 
@@ -154,45 +610,104 @@ int main(int argc, const char** argv) {
 
     auto stage_get_number = [&] () {
         for (int i = 0; i < max_requests; ++i) {
-            std::stringstream key;
-            key << "key" << i;
+            const auto key = "key" + std::to_string(i);
 
             NProto::TGetNumberRequest get_request;
             get_request.set_request_id(request_count++);
-            get_request.set_key(key.str());
+            get_request.set_key(key);
             expected_gets[get_request.request_id()] = generate_data(i);
 
-            std::stringstream message;
-            serialize_header(GET_NUMBER_REQUEST, get_request.ByteSizeLong(), message);
-            get_request.SerializeToOstream(&message);
+            std::string message;
+            serialize(GET_NUMBER_REQUEST, get_request, &message);
 
-            state.output_queue.push_back(message.str());
+            state.queue_output(std::move(message));
         }
     };
 
     auto stage_get = [&] () {
         for (int i = 0; i < max_requests; ++i) {
-            std::stringstream key;
-            key << "key" << i;
+            const auto key = "key" + std::to_string(i);
 
             NProto::TGetRequest get_request;
             get_request.set_request_id(request_count++);
-            get_request.set_key(key.str());
+            get_request.set_key(key);
             expected_gets2[get_request.request_id()] = generate_data2(i);
 
-            std::stringstream message;
-            serialize_header(GET_REQUEST, get_request.ByteSizeLong(), message);
-            get_request.SerializeToOstream(&message);
+            std::string message;
+            serialize(GET_REQUEST, get_request, &message);
+
+            state.queue_output(std::move(message));
+        }
+    };
+
+    auto stage_multi_put = [&] () {
+        for (int i = 0; i < max_requests; i += multi_batch_size) {
+            NProto::TMultiPutRequest put_request;
+            put_request.set_request_id(request_count++);
+            for (int j = i; j < std::min(max_requests, i + multi_batch_size); ++j) {
+                auto* kv = put_request.add_kvs();
+                kv->set_key("key" + std::to_string(j));
+                kv->set_value(generate_data2(j));
+            }
+
+            std::string message;
+            serialize(MULTI_PUT_REQUEST, put_request, &message);
 
-            state.output_queue.push_back(message.str());
+            state.queue_output(std::move(message));
         }
     };
 
+    std::unordered_map<uint64_t, std::vector<std::string>> expected_multi_gets;
+
+    auto stage_multi_get = [&] () {
+        for (int i = 0; i < max_requests; i += multi_batch_size) {
+            NProto::TMultiGetRequest get_request;
+            get_request.set_request_id(request_count++);
+            auto& expected = expected_multi_gets[get_request.request_id()];
+            for (int j = i; j < std::min(max_requests, i + multi_batch_size); ++j) {
+                get_request.add_keys("key" + std::to_string(j));
+                expected.push_back(generate_data2(j));
+            }
+
+            std::string message;
+            serialize(MULTI_GET_REQUEST, get_request, &message);
+
+            state.queue_output(std::move(message));
+        }
+    };
+
+    // scans the keys of the put stages, which are "key" followed by a number
+    auto stage_scan = [&] () {
+        NProto::TScanRequest scan_request;
+        scan_request.set_request_id(request_count++);
+        scan_request.set_start_key("key");
+        scan_request.set_end_key("kez");
+
+        std::string message;
+        serialize(SCAN_REQUEST, scan_request, &message);
+
+        state.queue_output(std::move(message));
+    };
+
+    auto stage_stats = [&] () {
+        NProto::TStatsRequest stats_request;
+        stats_request.set_request_id(request_count++);
+
+        std::string message;
+        serialize(STATS_REQUEST, stats_request, &message);
+
+        state.queue_output(std::move(message));
+    };
+
     std::unordered_map<std::string, std::function<void()>> stage2func = {
         {"put", stage_put},
         {"get", stage_get},
         {"put2", stage_put_number},
         {"get2", stage_get_number},
+        {"mput", stage_multi_put},
+        {"mget", stage_multi_get},
+        {"scan", stage_scan},
+        {"stats", stage_stats},
     };
 
     for (const auto& stage: stages) {
@@ -205,7 +720,7 @@ int main(int argc, const char** argv) {
 
     int response_count = 0;
 
-    auto handle_get_number = [&] (const std::string& response) {
+    auto handle_get_number = [&] (std::string_view response) {
         NProto::TGetNumberResponse get_response;
         if (!get_response.ParseFromArray(response.data(), response.size())) {
             // TODO proper handling
@@ -227,11 +742,9 @@ int main(int argc, const char** argv) {
         }
 
         ++response_count;
-
-        return std::string();
     };
 
-    auto handle_get = [&] (const std::string& response) {
+    auto handle_get = [&] (std::string_view response) {
         NProto::TGetResponse get_response;
         if (!get_response.ParseFromArray(response.data(), response.size())) {
             // TODO proper handling
@@ -253,11 +766,9 @@ int main(int argc, const char** argv) {
         }
 
         ++response_count;
-
-        return std::string();
     };
 
-    auto handle_put_number = [&] (const std::string& response) {
+    auto handle_put_number = [&] (std::string_view response) {
         NProto::TPutNumberResponse put_response;
         if (!put_response.ParseFromArray(response.data(), response.size())) {
             // TODO proper handling
@@ -267,11 +778,9 @@ int main(int argc, const char** argv) {
         LOG_DEBUG_S("put_response: " << put_response.ShortDebugString());
 
         ++response_count;
-
-        return std::string();
     };
 
-    auto handle_put = [&] (const std::string& response) {
+    auto handle_put = [&] (std::string_view response) {
         NProto::TPutResponse put_response;
         if (!put_response.ParseFromArray(response.data(), response.size())) {
             // TODO proper handling
@@ -281,22 +790,148 @@ int main(int argc, const char** argv) {
         LOG_DEBUG_S("put_response2: " << put_response.ShortDebugString());
 
         ++response_count;
+    };
+
+    auto handle_multi_get = [&] (std::string_view response) {
+        NProto::TMultiGetResponse get_response;
+        if (!get_response.ParseFromArray(response.data(), response.size())) {
+            // TODO proper handling
+
+            abort();
+        }
+
+        LOG_DEBUG_S("multi_get_response: " << get_response.ShortDebugString());
+
+        auto it = expected_multi_gets.find(get_response.request_id());
+        if (it == expected_multi_gets.end()) {
+            LOG_ERROR_S("unexpected multi_get request_id "
+                                << get_response.request_id());
+        } else if (!std::equal(
+                    it->second.begin(), it->second.end(),
+                    get_response.values().begin(), get_response.values().end()))
+        {
+            LOG_ERROR_S("unexpected data for multi_get request_id "
+                                << get_response.request_id());
+        }
+
+        ++response_count;
+    };
+
+    auto handle_multi_put = [&] (std::string_view response) {
+        NProto::TMultiPutResponse put_response;
+        if (!put_response.ParseFromArray(response.data(), response.size())) {
+            // TODO proper handling
+            abort();
+        }
+
+        LOG_DEBUG_S("multi_put_response: " << put_response.ShortDebugString());
+
+        ++response_count;
+    };
+
+    // keys of this run seen by the scan so far, and the last key seen
+    int scanned = 0;
+    std::string last_scanned;
+
+    auto handle_scan = [&] (std::string_view response, std::string* output) {
+        NProto::TScanResponse scan_response;
+        if (!scan_response.ParseFromArray(response.data(), response.size())) {
+            // TODO proper handling
+            abort();
+        }
+
+        LOG_DEBUG_S("scan_response: " << scan_response.kvs_size() << " keys, last "
+            << scan_response.last() << ", next_key " << scan_response.next_key());
+
+        if (scan_response.status() != NProto::TScanResponse::OK) {
+            LOG_ERROR_S("scan failed with status "
+                << NProto::TScanResponse::EStatus_Name(scan_response.status()));
+            ++response_count;
+            return;
+        }
+
+        for (const auto& kv: scan_response.kvs()) {
+            if (!last_scanned.empty() && kv.key() <= last_scanned) {
+                LOG_ERROR_S("scan out of order: " << kv.key() << " after " << last_scanned);
+            }
+            last_scanned = kv.key();
+
+            // keys of longer runs may be there as well
+            const auto i = atoi(kv.key().c_str() + 3);
+            if (i >= max_requests || kv.key() != "key" + std::to_string(i)) {
+                continue;
+            }
+
+            ++scanned;
+            if (kv.value() != generate_data2(i)) {
+                LOG_ERROR_S("unexpected data for scanned key " << kv.key()
+                    << ", actual " << kv.value()
+                    << ", expected " << generate_data2(i));
+            }
+        }
+
+        if (!scan_response.last()) {
+            return;
+        }
+
+        if (!scan_response.next_key().empty()) {
+            NProto::TScanRequest scan_request;
+            scan_request.set_request_id(scan_response.request_id());
+            scan_request.set_start_key(scan_response.next_key());
+            scan_request.set_end_key("kez");
+            serialize(SCAN_REQUEST, scan_request, output);
+            return;
+        }
+
+        if (scanned != max_requests) {
+            LOG_ERROR_S("scan found " << scanned << " keys, expected " << max_requests);
+        }
+
+        ++response_count;
+    };
+
+    auto handle_stats = [&] (std::string_view response) {
+        NProto::TStatsResponse stats_response;
+        if (!stats_response.ParseFromArray(response.data(), response.size())) {
+            // TODO proper handling
+            abort();
+        }
+
+        for (const auto& counter: stats_response.counters()) {
+            std::cout << counter.name() << ": " << counter.value() << std::endl;
+        }
+        for (const auto& h: stats_response.histograms()) {
+            std::cout << h.name() << ": count=" << h.count()
+                << " mean=" << h.mean()
+                << " p50=" << h.p50()
+                << " p99=" << h.p99()
+                << " p99.9=" << h.p999()
+                << " max=" << h.max() << std::endl;
+        }
 
-        return std::string();
+        ++response_count;
     };
 
-    Handler handler = [&] (int fd, char message_type, const std::string& response) {
+    Handler handler = [&] (
+        int fd,
+        char message_type,
+        std::string_view response,
+        std::string* output)
+    {
         switch (message_type) {
             case PUT_RESPONSE: return handle_put(response);
             case GET_RESPONSE: return handle_get(response);
             case PUT_NUMBER_RESPONSE: return handle_put_number(response);
             case GET_NUMBER_RESPONSE: return handle_get_number(response);
+            case MULTI_PUT_RESPONSE: return handle_multi_put(response);
+            case MULTI_GET_RESPONSE: return handle_multi_get(response);
+            case STATS_RESPONSE: return handle_stats(response);
+            case SCAN_RESPONSE: return handle_scan(response, output);
         }
 
         // TODO proper handling
 
         abort();
-        return std::string();
     };
 
     /*
@@ -331,7 +966,8 @@ int main(int argc, const char** argv) {
                 }
             }
 
-            if ((events[i].events & EPOLLOUT)) {
+            // the scan continues with requests queued by the handler
+            if ((events[i].events & EPOLLOUT) || !state.output_queue.empty()) {
                 if (!process_output(state)) {
                     LOG_ERROR("failed to send request");
                     return 3;
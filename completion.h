@@ -0,0 +1,108 @@
+#pragma once
+
+#include "log.h"
+#include "mpsc_queue.h"
+#include "rpc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace NRpc {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A response that is completed later, possibly on another thread: a PUT ack
+// after its group commit, a GET served by a disk thread. Responses go out in
+// completion order and clients match them by request_id, so a slow request
+// never holds back the ones after it on the same connection.
+struct Completion
+{
+    // index of the event loop that owns the connection
+    size_t owner = 0;
+    // a connection closed meanwhile just drops the response
+    std::weak_ptr<SocketState> state;
+    std::string response;
+};
+
+// Must be called on the loop thread that owns the connection, which then
+// expects the completion back through its CompletionQueue.
+inline Completion begin_completion(size_t owner, const SocketStatePtr& state)
+{
+    ++state->deferred_responses;
+    return {owner, state, {}};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Completions on their way back to the loop that owns the connections. Any
+// thread may complete(); the loop waits for fd() to become readable, reads
+// it and take()s everything.
+class CompletionQueue
+{
+private:
+    MpscQueue<std::vector<Completion>> queue;
+    int wakefd = -1;
+
+public:
+    // A blocking eventfd suits io_uring reads, epoll needs a nonblocking one.
+    explicit CompletionQueue(bool blocking)
+    {
+        wakefd = eventfd(0, EFD_CLOEXEC | (blocking ? 0 : EFD_NONBLOCK));
+        VERIFY(wakefd != -1, "eventfd failed");
+    }
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    ~CompletionQueue()
+    {
+        close(wakefd);
+    }
+
+    int fd() const
+    {
+        return wakefd;
+    }
+
+    void complete(std::vector<Completion> completions)
+    {
+        // the loop takes everything after reading the eventfd, so it only
+        // needs a wakeup for a queue it left empty
+        if (queue.push(std::move(completions))) {
+            const uint64_t one = 1;
+            if (write(wakefd, &one, sizeof(one)) != sizeof(one)) {
+                LOG_PERROR("eventfd write failed");
+            }
+        }
+    }
+
+    // Loop thread only. Queues the completed responses on their connections,
+    // returns the connections that had nothing else to send.
+    std::vector<SocketStatePtr> take()
+    {
+        std::vector<SocketStatePtr> touched;
+        queue.drain([&] (std::vector<Completion>& completions) {
+            for (auto& completion: completions) {
+                auto state = completion.state.lock();
+                if (!state || state->fd == -1) {
+                    continue;
+                }
+
+                if (state->output_queue.empty()) {
+                    touched.push_back(state);
+                }
+                --state->deferred_responses;
+                state->queue_output(std::move(completion.response));
+            }
+        });
+
+        return touched;
+    }
+};
+
+}   // namespace NRpc
@@ -0,0 +1,128 @@
+#ifndef LOCAL_STORAGE_COMPRESSION_H
+#define LOCAL_STORAGE_COMPRESSION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Value compression in the LZ4 block format: a sequence of (token, literal
+// run, 16-bit match offset, match length) with the same greedy single-probe
+// matcher as LZ4's fast mode. Self-contained, so the build doesn't depend on
+// liblz4; the output can still be decoded by LZ4_decompress_safe().
+
+namespace lz_detail {
+
+constexpr size_t min_match = 4;
+// the format requires the last match to start this far from the end and
+// the block to end with at least last_literals literals
+constexpr size_t match_limit = 12;
+constexpr size_t last_literals = 5;
+constexpr size_t max_offset = 65535;
+constexpr int hash_bits = 12;
+
+inline uint32_t read32(const char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t hash4(const char *p) {
+    return (read32(p) * 2654435761U) >> (32 - hash_bits);
+}
+
+// Lengths >= 15 continue in bytes of 255 and a final byte < 255.
+inline void append_length(std::string *out, size_t length) {
+    for (; length >= 255; length -= 255)
+        out->push_back(static_cast<char>(255));
+    out->push_back(static_cast<char>(length));
+}
+
+inline void append_sequence(std::string *out, const char *literals, size_t literal_count,
+                            size_t offset, size_t match_length) {
+    size_t match_code = match_length ? match_length - min_match : 0;
+    out->push_back(static_cast<char>((std::min<size_t>(literal_count, 15) << 4) | std::min<size_t>(match_code, 15)));
+    if (literal_count >= 15)
+        append_length(out, literal_count - 15);
+    out->append(literals, literal_count);
+    if (match_length == 0)
+        return;
+    out->push_back(static_cast<char>(offset & 0xff));
+    out->push_back(static_cast<char>(offset >> 8));
+    if (match_code >= 15)
+        append_length(out, match_code - 15);
+}
+
+}   // namespace lz_detail
+
+// Appends the compressed form of data[0, size) to `out`.
+inline void lz_compress(const char *data, size_t size, std::string *out) {
+    using namespace lz_detail;
+    uint32_t table[1 << hash_bits] = {};
+    size_t anchor = 0, pos = 0;
+    while (size >= match_limit && pos + match_limit <= size) {
+        uint32_t h = hash4(data + pos);
+        size_t candidate = table[h];
+        table[h] = pos;
+        if (candidate >= pos || pos - candidate > max_offset || read32(data + candidate) != read32(data + pos)) {
+            pos++;
+            continue;
+        }
+
+        size_t length = min_match;
+        while (pos + length < size - last_literals && data[candidate + length] == data[pos + length])
+            length++;
+        append_sequence(out, data + anchor, pos - anchor, pos - candidate, length);
+        pos += length;
+        anchor = pos;
+    }
+    append_sequence(out, data + anchor, size - anchor, 0, 0);
+}
+
+// Decodes a block into exactly out_size bytes; false if it is malformed.
+inline bool lz_decompress(const char *data, size_t size, char *out, size_t out_size) {
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(data), *in_end = in + size;
+    size_t written = 0;
+    auto read_length = [&](size_t length, size_t *result) {
+        if (length == 15) {
+            unsigned char byte;
+            do {
+                if (in == in_end)
+                    return false;
+                byte = *in++;
+                length += byte;
+            } while (byte == 255);
+        }
+        *result = length;
+        return true;
+    };
+
+    while (in < in_end) {
+        unsigned char token = *in++;
+        size_t literals, match;
+        if (!read_length(token >> 4, &literals) || literals > static_cast<size_t>(in_end - in)
+                || literals > out_size - written)
+            return false;
+        memcpy(out + written, in, literals);
+        in += literals;
+        written += literals;
+        if (in == in_end)
+            break;
+
+        if (in_end - in < 2)
+            return false;
+        size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if (!read_length(token & 15, &match))
+            return false;
+        match += lz_detail::min_match;
+        if (offset == 0 || offset > written || match > out_size - written)
+            return false;
+        // byte by byte: the match may overlap the bytes it produces
+        for (size_t i = 0; i < match; i++, written++)
+            out[written] = out[written - offset];
+    }
+    return written == out_size;
+}
+
+#endif //LOCAL_STORAGE_COMPRESSION_H
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "completion.h"
+#include "mpsc_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace NRpc {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Responses that may only be sent after the writes preceding them are durable.
+// Handlers add() an ack right after their write; the committer thread takes
+// batches with wait_batch(), syncs the storage and sends exactly the acks of
+// the batch it got.
+//
+// add() takes no lock: acks go through an MpscQueue and the committer is
+// woken through an eventfd only by the first ack of a batch and by the one
+// that fills it.
+class GroupCommit
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Ack
+    {
+        Completion completion;
+        Clock::time_point added;
+    };
+
+private:
+    const size_t batch_size;
+    const Clock::duration latency;
+
+    MpscQueue<Ack> queue;
+    // acks added but not yet taken, incremented before the push so that it
+    // never drops below the queue length
+    std::atomic<size_t> count = 0;
+    int wakefd = -1;
+
+public:
+    GroupCommit(size_t batch_size, Clock::duration latency)
+        : batch_size(batch_size)
+        , latency(latency)
+    {
+        wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        VERIFY(wakefd != -1, "eventfd failed");
+    }
+
+    GroupCommit(const GroupCommit&) = delete;
+    GroupCommit& operator=(const GroupCommit&) = delete;
+
+    ~GroupCommit()
+    {
+        close(wakefd);
+    }
+
+    void add(Completion completion)
+    {
+        const auto n = count.fetch_add(1, std::memory_order_relaxed) + 1;
+        queue.push({std::move(completion), Clock::now()});
+
+        if (n == 1 || n == batch_size) {
+            const uint64_t one = 1;
+            if (write(wakefd, &one, sizeof(one)) != sizeof(one)) {
+                LOG_PERROR("eventfd write failed");
+            }
+        }
+    }
+
+    // Acks waiting for the next wait_batch().
+    size_t pending() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    // Blocks until the batch is full or its oldest ack has waited for the
+    // latency target. Returns an empty batch if nothing arrived within timeout.
+    // Must only be called from a single thread.
+    std::vector<Ack> wait_batch(Clock::duration timeout)
+    {
+        if (!wait([&] { return pending() > 0; }, Clock::now() + timeout)) {
+            return {};
+        }
+
+        // the oldest ack can only be older than this
+        const auto deadline = Clock::now() + latency;
+        wait([&] { return pending() >= batch_size; }, deadline);
+
+        std::vector<Ack> result;
+        const auto taken = queue.drain([&] (Ack& ack) {
+            result.push_back(std::move(ack));
+        });
+        count.fetch_sub(taken, std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    // Waits on the eventfd until done() or the deadline, returns done().
+    template <typename F>
+    bool wait(F done, Clock::time_point deadline)
+    {
+        while (!done()) {
+            const auto now = Clock::now();
+            if (now >= deadline) {
+                return false;
+            }
+
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+            struct timespec ts;
+            ts.tv_sec = ns.count() / 1000000000;
+            ts.tv_nsec = ns.count() % 1000000000;
+            struct pollfd pfd = {wakefd, POLLIN, 0};
+            if (ppoll(&pfd, 1, &ts, nullptr) > 0) {
+                uint64_t value;
+                if (read(wakefd, &value, sizeof(value)) == -1 && errno != EAGAIN) {
+                    LOG_PERROR("eventfd read failed");
+                }
+            }
+        }
+
+        return true;
+    }
+};
+
+}   // namespace NRpc
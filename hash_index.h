@@ -0,0 +1,398 @@
+#ifndef LOCAL_STORAGE_HASH_INDEX_H
+#define LOCAL_STORAGE_HASH_INDEX_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// FNV-1a with a murmur3 finalizer. Unlike std::hash it is stable across builds,
+// so it can be used for anything that ends up on disk.
+inline uint64_t stable_hash(const char *data, size_t size) {
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 1099511628211ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Open-addressing hash table living in two memory-mapped files:
+//  * <name>.index - a header followed by a power-of-two array of fixed-size
+//    buckets, probed linearly;
+//  * <name>.keys - an append-only heap with the key bytes the buckets refer to.
+// Values are any trivially copyable type, stored inline in the buckets.
+// Nothing is loaded into RAM on open, so startup cost doesn't depend on the
+// number of keys. The files are not crash-consistent on their own: the caller
+// is expected to journal updates and call flush() before dropping the journal.
+//
+// The kernel writes the pages of both files back in any order, so after a
+// crash the buckets changed since the last flush may refer to key bytes that
+// never reached the disk. The header's dirty flag marks such an index: it is
+// on disk before the first change after a flush, and an index opened with it
+// set is rehashed, keeping only the buckets whose key is there; the journal
+// replay then restores what the others held.
+template <typename Value>
+class HashIndex {
+public:
+    static_assert(std::is_trivially_copyable<Value>::value, "values are stored as raw bytes");
+
+    HashIndex(const std::string &filename)
+        : index_filename(filename + ".index"), keys_filename(filename + ".keys") {
+        open_index();
+        open_keys();
+        if (header()->dirty)
+            repair();
+    }
+
+    ~HashIndex() {
+        flush();
+        munmap(index_data, index_mapped);
+        munmap(keys_data, keys_mapped);
+        close(index_fd);
+        close(keys_fd);
+    }
+
+    bool find(const std::string &key, Value *value) const {
+        return find(key, stable_hash(key.data(), key.size()), value);
+    }
+
+    // find() for a caller that already has the key's stable_hash().
+    bool find(const std::string &key, uint64_t key_hash, Value *value) const {
+        const Bucket *bucket = lookup(header(), key, key_hash);
+        if (!bucket->used)
+            return false;
+        *value = bucket->value;
+        return true;
+    }
+
+    // Returns true and the previous value if the key was already present.
+    bool put(const std::string &key, const Value &value, Value *old_value = nullptr) {
+        uint64_t h = stable_hash(key.data(), key.size());
+        Bucket *bucket = lookup(header(), key, h);
+        mark_dirty();
+        if (bucket->used) {
+            if (old_value != nullptr)
+                *old_value = bucket->value;
+            bucket->value = value;
+            return true;
+        }
+
+        if ((header()->size + 1) * 100 > header()->capacity * max_load_percent) {
+            rehash(header()->capacity * 2, false);
+            bucket = lookup(header(), key, h);
+        }
+
+        bucket->hash = h;
+        bucket->key_offset = append_key(key);
+        bucket->key_size = key.size();
+        bucket->value = value;
+        bucket->used = 1;
+        header()->size++;
+        return false;
+    }
+
+    uint64_t size() const {
+        return header()->size;
+    }
+
+    // Calls f with every key, in bucket order.
+    template <typename F>
+    void for_each_key(F f) const {
+        const Bucket *b = buckets(header());
+        for (uint64_t i = 0; i < header()->capacity; i++)
+            if (b[i].used)
+                f(std::string(keys_data + b[i].key_offset, b[i].key_size));
+    }
+
+    // Calls f with the stable_hash() of every key, without reading the keys.
+    template <typename F>
+    void for_each_hash(F f) const {
+        const Bucket *b = buckets(header());
+        for (uint64_t i = 0; i < header()->capacity; i++)
+            if (b[i].used)
+                f(b[i].hash);
+    }
+
+    // Writes all dirty pages of both files back to disk and clears the dirty
+    // flag.
+    void flush() {
+        if (msync(keys_data, keys_mapped, MS_SYNC) == -1 || fsync(keys_fd) == -1)
+            abort();
+        if (msync(index_data, index_mapped, MS_SYNC) == -1 || fsync(index_fd) == -1)
+            abort();
+        header()->dirty = 0;
+        sync_header();
+    }
+
+    // Duplicates of both files and the number of changes made so far, for
+    // sync_files() to write back without the lock the index is used under:
+    // fsync() also writes back the pages dirtied through the mappings, and a
+    // rehash in between syncs the table it builds itself.
+    struct SyncPoint {
+        std::vector<int> fds;
+        uint64_t changes = 0;
+    };
+
+    SyncPoint sync_point() const {
+        SyncPoint point{{dup(keys_fd), dup(index_fd)}, changes};
+        if (point.fds[0] == -1 || point.fds[1] == -1)
+            abort();
+        return point;
+    }
+
+    static void sync_files(const SyncPoint &point) {
+        for (int fd : point.fds) {
+            if (fsync(fd) == -1)
+                abort();
+            close(fd);
+        }
+    }
+
+    // Under the lock again after sync_files(): clears the dirty flag unless
+    // the index changed since the sync point, in which case the files on disk
+    // may not hold those changes. The flag may reach the disk any time later:
+    // the next change writes it again first.
+    void mark_clean(const SyncPoint &point) {
+        if (changes == point.changes)
+            header()->dirty = 0;
+    }
+
+private:
+    static constexpr uint64_t magic = 0x3130584449534c4cULL; // "LLSIDX01"
+    static constexpr uint64_t initial_capacity = 1024;
+    static constexpr uint64_t initial_keys_size = 64 * 1024;
+    static constexpr uint64_t max_load_percent = 70;
+
+    struct Header {
+        uint64_t magic;
+        uint64_t capacity;
+        uint64_t size;
+        uint64_t keys_size;
+        // so that an index written for another value type is rejected
+        uint64_t bucket_size;
+        // nonzero while the files on disk may be inconsistent, see above
+        uint64_t dirty;
+        uint64_t reserved[2];
+    };
+
+    struct Bucket {
+        uint64_t hash;
+        uint64_t key_offset;
+        uint32_t key_size;
+        uint32_t used;
+        Value value;
+    };
+
+    static_assert(sizeof(Header) == 64, "unexpected header size");
+
+    std::string index_filename;
+    std::string keys_filename;
+    int index_fd = -1, keys_fd = -1;
+    char *index_data = nullptr, *keys_data = nullptr;
+    uint64_t index_mapped = 0, keys_mapped = 0;
+    // changes made since the index was opened, under the caller's lock
+    uint64_t changes = 0;
+
+    static uint64_t index_file_size(uint64_t capacity) {
+        return sizeof(Header) + capacity * sizeof(Bucket);
+    }
+
+    static char *map_file(int fd, uint64_t size) {
+        void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+            abort();
+        return static_cast<char *>(data);
+    }
+
+    static Bucket *buckets(Header *h) {
+        return reinterpret_cast<Bucket *>(h + 1);
+    }
+
+    Header *header() const {
+        return reinterpret_cast<Header *>(index_data);
+    }
+
+    // Returns the bucket holding the key or the empty bucket where it belongs.
+    Bucket *lookup(Header *h, const std::string &key, uint64_t key_hash) const {
+        uint64_t mask = h->capacity - 1;
+        Bucket *b = buckets(h);
+        for (uint64_t i = key_hash & mask;; i = (i + 1) & mask) {
+            if (!b[i].used)
+                return &b[i];
+            if (b[i].hash == key_hash && b[i].key_size == key.size()
+                    && memcmp(keys_data + b[i].key_offset, key.data(), key.size()) == 0)
+                return &b[i];
+        }
+    }
+
+    static int open_file(const std::string &filename) {
+        int fd = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd == -1)
+            abort();
+        return fd;
+    }
+
+    static uint64_t file_size(int fd) {
+        struct stat st;
+        if (fstat(fd, &st) == -1)
+            abort();
+        return st.st_size;
+    }
+
+    static int create_index_file(const std::string &filename, uint64_t capacity, uint64_t keys_size) {
+        int fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd == -1 || ftruncate(fd, index_file_size(capacity)) == -1)
+            abort();
+        Header h = {magic, capacity, 0, keys_size, sizeof(Bucket), 0, {}};
+        if (pwrite(fd, &h, sizeof(h), 0) != sizeof(h))
+            abort();
+        return fd;
+    }
+
+    void open_index() {
+        index_fd = open_file(index_filename);
+        if (file_size(index_fd) == 0) {
+            close(index_fd);
+            index_fd = create_index_file(index_filename, initial_capacity, 0);
+        }
+        index_mapped = file_size(index_fd);
+        index_data = map_file(index_fd, index_mapped);
+        if (header()->magic != magic || header()->bucket_size != sizeof(Bucket)
+                || index_mapped != index_file_size(header()->capacity))
+            abort();
+    }
+
+    void open_keys() {
+        keys_fd = open_file(keys_filename);
+        keys_mapped = file_size(keys_fd);
+        // a dirty index may have lost the file's growth, repair() copes
+        if (keys_mapped < header()->keys_size && !header()->dirty)
+            abort();
+        if (keys_mapped == 0) {
+            keys_mapped = initial_keys_size;
+            if (ftruncate(keys_fd, keys_mapped) == -1)
+                abort();
+        }
+        keys_data = map_file(keys_fd, keys_mapped);
+    }
+
+    uint64_t append_key(const std::string &key) {
+        uint64_t offset = header()->keys_size;
+        if (offset + key.size() > keys_mapped) {
+            uint64_t new_size = keys_mapped;
+            while (offset + key.size() > new_size)
+                new_size *= 2;
+            if (ftruncate(keys_fd, new_size) == -1)
+                abort();
+            void *data = mremap(keys_data, keys_mapped, new_size, MREMAP_MAYMOVE);
+            if (data == MAP_FAILED)
+                abort();
+            keys_data = static_cast<char *>(data);
+            keys_mapped = new_size;
+        }
+        memcpy(keys_data + offset, key.data(), key.size());
+        header()->keys_size = offset + key.size();
+        return offset;
+    }
+
+    // The first change after a flush waits for the dirty flag to be on disk,
+    // so that no page written back ahead of it goes unnoticed.
+    void mark_dirty() {
+        changes++;
+        if (header()->dirty)
+            return;
+        header()->dirty = 1;
+        sync_header();
+    }
+
+    void sync_header() {
+        if (msync(index_data, sizeof(Header), MS_SYNC) == -1)
+            abort();
+    }
+
+    // Drops the buckets of a dirty index whose key lies past the end of the
+    // key heap or doesn't hash to the bucket's hash, i.e. didn't reach the disk
+    // before the crash, along with duplicates of a key.
+    void repair() {
+        uint64_t size = header()->size;
+        header()->keys_size = std::min(header()->keys_size, keys_mapped);
+        rehash(header()->capacity, true);
+        if (header()->size != size)
+            std::cerr << index_filename << " was not synced, dropped " << size - header()->size
+                << " of " << size << " entries" << std::endl;
+    }
+
+    bool valid(const Bucket &bucket) const {
+        uint64_t keys_size = header()->keys_size;
+        return bucket.key_offset <= keys_size && bucket.key_size <= keys_size - bucket.key_offset
+            && stable_hash(keys_data + bucket.key_offset, bucket.key_size) == bucket.hash;
+    }
+
+    // Rehashes into a table of `capacity` buckets, keeping only valid() ones
+    // with `check`. The new table is built next to the old one and renamed
+    // over it, so a crash mid-resize leaves a valid index; it keeps the dirty
+    // flag, since the keys its buckets refer to may not be on disk yet.
+    void rehash(uint64_t capacity, bool check) {
+        Header *old_header = header();
+        std::string tmp_filename = index_filename + ".tmp";
+        int fd = create_index_file(tmp_filename, capacity, old_header->keys_size);
+        uint64_t mapped = index_file_size(capacity);
+        char *data = map_file(fd, mapped);
+
+        Header *new_header = reinterpret_cast<Header *>(data);
+        Bucket *old_buckets = buckets(old_header);
+        Bucket *new_buckets = buckets(new_header);
+        uint64_t mask = capacity - 1, size = 0;
+        for (uint64_t i = 0; i < old_header->capacity; i++) {
+            const Bucket &b = old_buckets[i];
+            if (!b.used)
+                continue;
+            Bucket *bucket;
+            if (check) {
+                if (!valid(b))
+                    continue;
+                bucket = lookup(new_header, std::string(keys_data + b.key_offset, b.key_size), b.hash);
+                if (bucket->used)
+                    continue;
+            } else {
+                uint64_t j = b.hash & mask;
+                while (new_buckets[j].used)
+                    j = (j + 1) & mask;
+                bucket = &new_buckets[j];
+            }
+            *bucket = b;
+            size++;
+        }
+        new_header->size = size;
+        new_header->dirty = old_header->dirty;
+
+        if (msync(data, mapped, MS_SYNC) == -1 || fsync(fd) == -1)
+            abort();
+        if (rename(tmp_filename.c_str(), index_filename.c_str()) == -1)
+            abort();
+
+        munmap(index_data, index_mapped);
+        close(index_fd);
+        index_fd = fd;
+        index_data = data;
+        index_mapped = mapped;
+    }
+};
+
+#endif //LOCAL_STORAGE_HASH_INDEX_H
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+namespace NMetrics {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// HDR-style log-linear histogram: values below 2^sub_bucket_bits are counted
+// exactly, larger ones in buckets of relative width 1/2^sub_bucket_bits
+// (about 3%). Fixed size, no allocation, record() is a handful of
+// instructions.
+class Histogram
+{
+private:
+    static constexpr int sub_bucket_bits = 5;
+    static constexpr uint64_t sub_buckets = 1ULL << sub_bucket_bits;
+    static constexpr size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+    std::array<uint64_t, bucket_count> counts = {};
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    uint64_t max_value = 0;
+
+public:
+    void record(uint64_t value)
+    {
+        ++counts[bucket(value)];
+        ++total;
+        sum += value;
+        max_value = std::max(max_value, value);
+    }
+
+    void merge(const Histogram& other)
+    {
+        for (size_t i = 0; i < bucket_count; ++i) {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        max_value = std::max(max_value, other.max_value);
+    }
+
+    uint64_t count() const
+    {
+        return total;
+    }
+
+    uint64_t max() const
+    {
+        return max_value;
+    }
+
+    uint64_t mean() const
+    {
+        return total ? sum / total : 0;
+    }
+
+    // Upper bound of the bucket holding the q-th quantile, q in [0, 1].
+    uint64_t percentile(double q) const
+    {
+        if (total == 0) {
+            return 0;
+        }
+
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(q * total + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::min(max_value, upper_bound(i));
+            }
+        }
+
+        return max_value;
+    }
+
+    // "count=N mean=X p50=X p99=X p99.9=X max=X"
+    void print(std::ostream& out) const
+    {
+        out << "count=" << count()
+            << " mean=" << mean()
+            << " p50=" << percentile(0.5)
+            << " p99=" << percentile(0.99)
+            << " p99.9=" << percentile(0.999)
+            << " max=" << max();
+    }
+
+private:
+    static size_t bucket(uint64_t value)
+    {
+        if (value < sub_buckets) {
+            return value;
+        }
+
+        const int exponent = 63 - __builtin_clzll(value);
+        const int shift = exponent - sub_bucket_bits;
+        const auto mantissa = value >> shift;
+        return (shift + 1) * sub_buckets + (mantissa - sub_buckets);
+    }
+
+    static uint64_t upper_bound(size_t index)
+    {
+        if (index < sub_buckets) {
+            return index;
+        }
+
+        const int shift = index / sub_buckets - 1;
+        const auto mantissa = index % sub_buckets + sub_buckets;
+        return ((mantissa + 1) << shift) - 1;
+    }
+};
+
+}   // namespace NMetrics
@@ -0,0 +1,148 @@
+#ifndef LOCAL_STORAGE_JOURNAL_H
+#define LOCAL_STORAGE_JOURNAL_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+// CRC32C (Castagnoli), the checksum of journal records. Uses the SSE4.2
+// instruction when the build enables it and a lookup table otherwise.
+inline uint32_t crc32c(uint32_t crc, const char *data, size_t size) {
+    crc = ~crc;
+#if defined(__SSE4_2__)
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        crc = static_cast<uint32_t>(_mm_crc32_u64(crc, word));
+    }
+    for (; size > 0; size--, data++)
+        crc = _mm_crc32_u8(crc, static_cast<unsigned char>(*data));
+#else
+    struct Table {
+        uint32_t entries[256];
+
+        Table() {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? (c >> 1) ^ 0x82f63b78U : c >> 1;
+                entries[i] = c;
+            }
+        }
+    };
+    static const Table table;
+    for (; size > 0; size--, data++)
+        crc = table.entries[(crc ^ static_cast<unsigned char>(*data)) & 0xff] ^ (crc >> 8);
+#endif
+    return ~crc;
+}
+
+// Every journal starts with this header. Files without it were written before
+// it was added: either headerless binary records, or the text journal of
+// "key number " pairs that came before them.
+constexpr char journal_header[] = {'L', 'S', 'J', 'N', 'L', '\0', '\0', '\1'};
+
+inline void append_journal_header(std::string *out) {
+    out->append(journal_header, sizeof(journal_header));
+}
+
+// Journal record: key size (u32), key bytes, the raw bytes of the value and the
+// CRC32C of all of the above (u32), little-endian as laid out in memory.
+template <typename Value>
+void append_journal_record(std::string *out, const std::string &key, const Value &value) {
+    size_t start = out->size();
+    uint32_t key_size = key.size();
+    out->append(reinterpret_cast<const char *>(&key_size), sizeof(key_size));
+    out->append(key);
+    out->append(reinterpret_cast<const char *>(&value), sizeof(value));
+    uint32_t crc = crc32c(0, out->data() + start, out->size() - start);
+    out->append(reinterpret_cast<const char *>(&crc), sizeof(crc));
+}
+
+// Streams records out of a journal file. Stops at the end of the file or at
+// the first record that is cut short or fails its checksum: that's the torn
+// tail of a write interrupted by a crash, and nothing after it was acked.
+class JournalReader {
+public:
+    JournalReader(const std::string &filename) {
+        file = fopen(filename.c_str(), "rb");
+        if (file == nullptr)
+            return;
+        char header[sizeof(journal_header)];
+        size_t size = fread(header, 1, sizeof(header), file);
+        empty = size == 0;
+        legacy = !empty && (size < sizeof(header) || memcmp(header, journal_header, sizeof(header)) != 0);
+        if (legacy)
+            rewind(file);
+    }
+
+    // Whether the file is missing or empty, i.e. a new journal.
+    bool is_empty() const {
+        return file == nullptr || empty;
+    }
+
+    // Whether the file has no header, see journal_header.
+    bool is_legacy() const {
+        return legacy;
+    }
+
+    ~JournalReader() {
+        if (file != nullptr)
+            fclose(file);
+    }
+
+    template <typename Value>
+    bool next(std::string *key, Value *value) {
+        if (file == nullptr)
+            return false;
+        uint32_t key_size, crc;
+        if (!read(&key_size, sizeof(key_size)) || key_size > max_key_size)
+            return false;
+        record.resize(sizeof(key_size) + key_size + sizeof(Value));
+        memcpy(&record[0], &key_size, sizeof(key_size));
+        if (!read(&record[sizeof(key_size)], key_size + sizeof(Value)) || !read(&crc, sizeof(crc)))
+            return false;
+        if (crc32c(0, record.data(), record.size()) != crc)
+            return false;
+        key->assign(record.data() + sizeof(key_size), key_size);
+        memcpy(value, record.data() + sizeof(key_size) + key_size, sizeof(Value));
+        return true;
+    }
+
+private:
+    // anything larger is garbage from a torn write, not a key
+    static constexpr uint32_t max_key_size = 1 << 30;
+
+    FILE *file = nullptr;
+    bool empty = true;
+    bool legacy = false;
+    std::string record;
+
+    bool read(void *data, size_t size) {
+        return fread(data, 1, size, file) == size;
+    }
+};
+
+// Reads a text journal to the end; false unless all of it is "key number "
+// pairs.
+inline bool read_text_journal(const std::string &filename, std::vector<std::pair<std::string, uint64_t>> *entries) {
+    std::ifstream f(filename);
+    std::string key;
+    uint64_t number;
+    while (f >> key) {
+        if (!(f >> number))
+            return false;
+        entries->push_back({key, number});
+    }
+    return f.eof();
+}
+
+#endif //LOCAL_STORAGE_JOURNAL_H
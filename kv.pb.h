@@ -0,0 +1,5704 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: kv.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_kv_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_kv_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_kv_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_kv_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kv_2eproto;
+namespace NProto {
+class TCounter;
+struct TCounterDefaultTypeInternal;
+extern TCounterDefaultTypeInternal _TCounter_default_instance_;
+class TGetNumberRequest;
+struct TGetNumberRequestDefaultTypeInternal;
+extern TGetNumberRequestDefaultTypeInternal _TGetNumberRequest_default_instance_;
+class TGetNumberResponse;
+struct TGetNumberResponseDefaultTypeInternal;
+extern TGetNumberResponseDefaultTypeInternal _TGetNumberResponse_default_instance_;
+class TGetRequest;
+struct TGetRequestDefaultTypeInternal;
+extern TGetRequestDefaultTypeInternal _TGetRequest_default_instance_;
+class TGetResponse;
+struct TGetResponseDefaultTypeInternal;
+extern TGetResponseDefaultTypeInternal _TGetResponse_default_instance_;
+class THistogram;
+struct THistogramDefaultTypeInternal;
+extern THistogramDefaultTypeInternal _THistogram_default_instance_;
+class TKeyValue;
+struct TKeyValueDefaultTypeInternal;
+extern TKeyValueDefaultTypeInternal _TKeyValue_default_instance_;
+class TMultiGetRequest;
+struct TMultiGetRequestDefaultTypeInternal;
+extern TMultiGetRequestDefaultTypeInternal _TMultiGetRequest_default_instance_;
+class TMultiGetResponse;
+struct TMultiGetResponseDefaultTypeInternal;
+extern TMultiGetResponseDefaultTypeInternal _TMultiGetResponse_default_instance_;
+class TMultiPutRequest;
+struct TMultiPutRequestDefaultTypeInternal;
+extern TMultiPutRequestDefaultTypeInternal _TMultiPutRequest_default_instance_;
+class TMultiPutResponse;
+struct TMultiPutResponseDefaultTypeInternal;
+extern TMultiPutResponseDefaultTypeInternal _TMultiPutResponse_default_instance_;
+class TPutNumberRequest;
+struct TPutNumberRequestDefaultTypeInternal;
+extern TPutNumberRequestDefaultTypeInternal _TPutNumberRequest_default_instance_;
+class TPutNumberResponse;
+struct TPutNumberResponseDefaultTypeInternal;
+extern TPutNumberResponseDefaultTypeInternal _TPutNumberResponse_default_instance_;
+class TPutRequest;
+struct TPutRequestDefaultTypeInternal;
+extern TPutRequestDefaultTypeInternal _TPutRequest_default_instance_;
+class TPutResponse;
+struct TPutResponseDefaultTypeInternal;
+extern TPutResponseDefaultTypeInternal _TPutResponse_default_instance_;
+class TReplicateRequest;
+struct TReplicateRequestDefaultTypeInternal;
+extern TReplicateRequestDefaultTypeInternal _TReplicateRequest_default_instance_;
+class TReplicateResponse;
+struct TReplicateResponseDefaultTypeInternal;
+extern TReplicateResponseDefaultTypeInternal _TReplicateResponse_default_instance_;
+class TScanRequest;
+struct TScanRequestDefaultTypeInternal;
+extern TScanRequestDefaultTypeInternal _TScanRequest_default_instance_;
+class TScanResponse;
+struct TScanResponseDefaultTypeInternal;
+extern TScanResponseDefaultTypeInternal _TScanResponse_default_instance_;
+class TStatsRequest;
+struct TStatsRequestDefaultTypeInternal;
+extern TStatsRequestDefaultTypeInternal _TStatsRequest_default_instance_;
+class TStatsResponse;
+struct TStatsResponseDefaultTypeInternal;
+extern TStatsResponseDefaultTypeInternal _TStatsResponse_default_instance_;
+}  // namespace NProto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::NProto::TCounter* Arena::CreateMaybeMessage<::NProto::TCounter>(Arena*);
+template<> ::NProto::TGetNumberRequest* Arena::CreateMaybeMessage<::NProto::TGetNumberRequest>(Arena*);
+template<> ::NProto::TGetNumberResponse* Arena::CreateMaybeMessage<::NProto::TGetNumberResponse>(Arena*);
+template<> ::NProto::TGetRequest* Arena::CreateMaybeMessage<::NProto::TGetRequest>(Arena*);
+template<> ::NProto::TGetResponse* Arena::CreateMaybeMessage<::NProto::TGetResponse>(Arena*);
+template<> ::NProto::THistogram* Arena::CreateMaybeMessage<::NProto::THistogram>(Arena*);
+template<> ::NProto::TKeyValue* Arena::CreateMaybeMessage<::NProto::TKeyValue>(Arena*);
+template<> ::NProto::TMultiGetRequest* Arena::CreateMaybeMessage<::NProto::TMultiGetRequest>(Arena*);
+template<> ::NProto::TMultiGetResponse* Arena::CreateMaybeMessage<::NProto::TMultiGetResponse>(Arena*);
+template<> ::NProto::TMultiPutRequest* Arena::CreateMaybeMessage<::NProto::TMultiPutRequest>(Arena*);
+template<> ::NProto::TMultiPutResponse* Arena::CreateMaybeMessage<::NProto::TMultiPutResponse>(Arena*);
+template<> ::NProto::TPutNumberRequest* Arena::CreateMaybeMessage<::NProto::TPutNumberRequest>(Arena*);
+template<> ::NProto::TPutNumberResponse* Arena::CreateMaybeMessage<::NProto::TPutNumberResponse>(Arena*);
+template<> ::NProto::TPutRequest* Arena::CreateMaybeMessage<::NProto::TPutRequest>(Arena*);
+template<> ::NProto::TPutResponse* Arena::CreateMaybeMessage<::NProto::TPutResponse>(Arena*);
+template<> ::NProto::TReplicateRequest* Arena::CreateMaybeMessage<::NProto::TReplicateRequest>(Arena*);
+template<> ::NProto::TReplicateResponse* Arena::CreateMaybeMessage<::NProto::TReplicateResponse>(Arena*);
+template<> ::NProto::TScanRequest* Arena::CreateMaybeMessage<::NProto::TScanRequest>(Arena*);
+template<> ::NProto::TScanResponse* Arena::CreateMaybeMessage<::NProto::TScanResponse>(Arena*);
+template<> ::NProto::TStatsRequest* Arena::CreateMaybeMessage<::NProto::TStatsRequest>(Arena*);
+template<> ::NProto::TStatsResponse* Arena::CreateMaybeMessage<::NProto::TStatsResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace NProto {
+
+enum TScanResponse_EStatus : int {
+  TScanResponse_EStatus_OK = 0,
+  TScanResponse_EStatus_UNSUPPORTED = 1,
+  TScanResponse_EStatus_TScanResponse_EStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TScanResponse_EStatus_TScanResponse_EStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TScanResponse_EStatus_IsValid(int value);
+constexpr TScanResponse_EStatus TScanResponse_EStatus_EStatus_MIN = TScanResponse_EStatus_OK;
+constexpr TScanResponse_EStatus TScanResponse_EStatus_EStatus_MAX = TScanResponse_EStatus_UNSUPPORTED;
+constexpr int TScanResponse_EStatus_EStatus_ARRAYSIZE = TScanResponse_EStatus_EStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TScanResponse_EStatus_descriptor();
+template<typename T>
+inline const std::string& TScanResponse_EStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TScanResponse_EStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TScanResponse_EStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TScanResponse_EStatus_descriptor(), enum_t_value);
+}
+inline bool TScanResponse_EStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TScanResponse_EStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TScanResponse_EStatus>(
+    TScanResponse_EStatus_descriptor(), name, value);
+}
+// ===================================================================
+
+class TPutNumberRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TPutNumberRequest) */ {
+ public:
+  inline TPutNumberRequest() : TPutNumberRequest(nullptr) {}
+  ~TPutNumberRequest() override;
+  explicit PROTOBUF_CONSTEXPR TPutNumberRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TPutNumberRequest(const TPutNumberRequest& from);
+  TPutNumberRequest(TPutNumberRequest&& from) noexcept
+    : TPutNumberRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TPutNumberRequest& operator=(const TPutNumberRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TPutNumberRequest& operator=(TPutNumberRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TPutNumberRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TPutNumberRequest* internal_default_instance() {
+    return reinterpret_cast<const TPutNumberRequest*>(
+               &_TPutNumberRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TPutNumberRequest& a, TPutNumberRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TPutNumberRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TPutNumberRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TPutNumberRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TPutNumberRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TPutNumberRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TPutNumberRequest& from) {
+    TPutNumberRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TPutNumberRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TPutNumberRequest";
+  }
+  protected:
+  explicit TPutNumberRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+    kOffsetFieldNumber = 3,
+  };
+  // string key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 offset = 3;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TPutNumberRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t request_id_;
+    uint64_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TPutNumberResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TPutNumberResponse) */ {
+ public:
+  inline TPutNumberResponse() : TPutNumberResponse(nullptr) {}
+  ~TPutNumberResponse() override;
+  explicit PROTOBUF_CONSTEXPR TPutNumberResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TPutNumberResponse(const TPutNumberResponse& from);
+  TPutNumberResponse(TPutNumberResponse&& from) noexcept
+    : TPutNumberResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TPutNumberResponse& operator=(const TPutNumberResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TPutNumberResponse& operator=(TPutNumberResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TPutNumberResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TPutNumberResponse* internal_default_instance() {
+    return reinterpret_cast<const TPutNumberResponse*>(
+               &_TPutNumberResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TPutNumberResponse& a, TPutNumberResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TPutNumberResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TPutNumberResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TPutNumberResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TPutNumberResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TPutNumberResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TPutNumberResponse& from) {
+    TPutNumberResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TPutNumberResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TPutNumberResponse";
+  }
+  protected:
+  explicit TPutNumberResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 1,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TPutNumberResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TGetNumberRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TGetNumberRequest) */ {
+ public:
+  inline TGetNumberRequest() : TGetNumberRequest(nullptr) {}
+  ~TGetNumberRequest() override;
+  explicit PROTOBUF_CONSTEXPR TGetNumberRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TGetNumberRequest(const TGetNumberRequest& from);
+  TGetNumberRequest(TGetNumberRequest&& from) noexcept
+    : TGetNumberRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TGetNumberRequest& operator=(const TGetNumberRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TGetNumberRequest& operator=(TGetNumberRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TGetNumberRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TGetNumberRequest* internal_default_instance() {
+    return reinterpret_cast<const TGetNumberRequest*>(
+               &_TGetNumberRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TGetNumberRequest& a, TGetNumberRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TGetNumberRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TGetNumberRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TGetNumberRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TGetNumberRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TGetNumberRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TGetNumberRequest& from) {
+    TGetNumberRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TGetNumberRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TGetNumberRequest";
+  }
+  protected:
+  explicit TGetNumberRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+  };
+  // string key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TGetNumberRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TGetNumberResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TGetNumberResponse) */ {
+ public:
+  inline TGetNumberResponse() : TGetNumberResponse(nullptr) {}
+  ~TGetNumberResponse() override;
+  explicit PROTOBUF_CONSTEXPR TGetNumberResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TGetNumberResponse(const TGetNumberResponse& from);
+  TGetNumberResponse(TGetNumberResponse&& from) noexcept
+    : TGetNumberResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TGetNumberResponse& operator=(const TGetNumberResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TGetNumberResponse& operator=(TGetNumberResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TGetNumberResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TGetNumberResponse* internal_default_instance() {
+    return reinterpret_cast<const TGetNumberResponse*>(
+               &_TGetNumberResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TGetNumberResponse& a, TGetNumberResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TGetNumberResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TGetNumberResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TGetNumberResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TGetNumberResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TGetNumberResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TGetNumberResponse& from) {
+    TGetNumberResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TGetNumberResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TGetNumberResponse";
+  }
+  protected:
+  explicit TGetNumberResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 offset = 2;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TGetNumberResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    uint64_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TPutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TPutRequest) */ {
+ public:
+  inline TPutRequest() : TPutRequest(nullptr) {}
+  ~TPutRequest() override;
+  explicit PROTOBUF_CONSTEXPR TPutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TPutRequest(const TPutRequest& from);
+  TPutRequest(TPutRequest&& from) noexcept
+    : TPutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TPutRequest& operator=(const TPutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TPutRequest& operator=(TPutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TPutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TPutRequest* internal_default_instance() {
+    return reinterpret_cast<const TPutRequest*>(
+               &_TPutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TPutRequest& a, TPutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TPutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TPutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TPutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TPutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TPutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TPutRequest& from) {
+    TPutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TPutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TPutRequest";
+  }
+  protected:
+  explicit TPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kRequestIdFieldNumber = 1,
+  };
+  // string key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TPutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TPutResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TPutResponse) */ {
+ public:
+  inline TPutResponse() : TPutResponse(nullptr) {}
+  ~TPutResponse() override;
+  explicit PROTOBUF_CONSTEXPR TPutResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TPutResponse(const TPutResponse& from);
+  TPutResponse(TPutResponse&& from) noexcept
+    : TPutResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TPutResponse& operator=(const TPutResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TPutResponse& operator=(TPutResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TPutResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TPutResponse* internal_default_instance() {
+    return reinterpret_cast<const TPutResponse*>(
+               &_TPutResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(TPutResponse& a, TPutResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TPutResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TPutResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TPutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TPutResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TPutResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TPutResponse& from) {
+    TPutResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TPutResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TPutResponse";
+  }
+  protected:
+  explicit TPutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 1,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TPutResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TGetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TGetRequest) */ {
+ public:
+  inline TGetRequest() : TGetRequest(nullptr) {}
+  ~TGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR TGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TGetRequest(const TGetRequest& from);
+  TGetRequest(TGetRequest&& from) noexcept
+    : TGetRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TGetRequest& operator=(const TGetRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TGetRequest& operator=(TGetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TGetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TGetRequest* internal_default_instance() {
+    return reinterpret_cast<const TGetRequest*>(
+               &_TGetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(TGetRequest& a, TGetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TGetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TGetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TGetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TGetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TGetRequest& from) {
+    TGetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TGetRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TGetRequest";
+  }
+  protected:
+  explicit TGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+  };
+  // string key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TGetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TGetResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TGetResponse) */ {
+ public:
+  inline TGetResponse() : TGetResponse(nullptr) {}
+  ~TGetResponse() override;
+  explicit PROTOBUF_CONSTEXPR TGetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TGetResponse(const TGetResponse& from);
+  TGetResponse(TGetResponse&& from) noexcept
+    : TGetResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TGetResponse& operator=(const TGetResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TGetResponse& operator=(TGetResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TGetResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TGetResponse* internal_default_instance() {
+    return reinterpret_cast<const TGetResponse*>(
+               &_TGetResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(TGetResponse& a, TGetResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TGetResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TGetResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TGetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TGetResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TGetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TGetResponse& from) {
+    TGetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TGetResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TGetResponse";
+  }
+  protected:
+  explicit TGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+  };
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TGetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TKeyValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TKeyValue) */ {
+ public:
+  inline TKeyValue() : TKeyValue(nullptr) {}
+  ~TKeyValue() override;
+  explicit PROTOBUF_CONSTEXPR TKeyValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TKeyValue(const TKeyValue& from);
+  TKeyValue(TKeyValue&& from) noexcept
+    : TKeyValue() {
+    *this = ::std::move(from);
+  }
+
+  inline TKeyValue& operator=(const TKeyValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TKeyValue& operator=(TKeyValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TKeyValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TKeyValue* internal_default_instance() {
+    return reinterpret_cast<const TKeyValue*>(
+               &_TKeyValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(TKeyValue& a, TKeyValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TKeyValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TKeyValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TKeyValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TKeyValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TKeyValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TKeyValue& from) {
+    TKeyValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TKeyValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TKeyValue";
+  }
+  protected:
+  explicit TKeyValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TKeyValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TMultiPutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TMultiPutRequest) */ {
+ public:
+  inline TMultiPutRequest() : TMultiPutRequest(nullptr) {}
+  ~TMultiPutRequest() override;
+  explicit PROTOBUF_CONSTEXPR TMultiPutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TMultiPutRequest(const TMultiPutRequest& from);
+  TMultiPutRequest(TMultiPutRequest&& from) noexcept
+    : TMultiPutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TMultiPutRequest& operator=(const TMultiPutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TMultiPutRequest& operator=(TMultiPutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TMultiPutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TMultiPutRequest* internal_default_instance() {
+    return reinterpret_cast<const TMultiPutRequest*>(
+               &_TMultiPutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(TMultiPutRequest& a, TMultiPutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TMultiPutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TMultiPutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TMultiPutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TMultiPutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TMultiPutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TMultiPutRequest& from) {
+    TMultiPutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TMultiPutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TMultiPutRequest";
+  }
+  protected:
+  explicit TMultiPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvsFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+  };
+  // repeated .NProto.TKeyValue kvs = 2;
+  int kvs_size() const;
+  private:
+  int _internal_kvs_size() const;
+  public:
+  void clear_kvs();
+  ::NProto::TKeyValue* mutable_kvs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >*
+      mutable_kvs();
+  private:
+  const ::NProto::TKeyValue& _internal_kvs(int index) const;
+  ::NProto::TKeyValue* _internal_add_kvs();
+  public:
+  const ::NProto::TKeyValue& kvs(int index) const;
+  ::NProto::TKeyValue* add_kvs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >&
+      kvs() const;
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TMultiPutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue > kvs_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TMultiPutResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TMultiPutResponse) */ {
+ public:
+  inline TMultiPutResponse() : TMultiPutResponse(nullptr) {}
+  ~TMultiPutResponse() override;
+  explicit PROTOBUF_CONSTEXPR TMultiPutResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TMultiPutResponse(const TMultiPutResponse& from);
+  TMultiPutResponse(TMultiPutResponse&& from) noexcept
+    : TMultiPutResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TMultiPutResponse& operator=(const TMultiPutResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TMultiPutResponse& operator=(TMultiPutResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TMultiPutResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TMultiPutResponse* internal_default_instance() {
+    return reinterpret_cast<const TMultiPutResponse*>(
+               &_TMultiPutResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(TMultiPutResponse& a, TMultiPutResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TMultiPutResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TMultiPutResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TMultiPutResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TMultiPutResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TMultiPutResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TMultiPutResponse& from) {
+    TMultiPutResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TMultiPutResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TMultiPutResponse";
+  }
+  protected:
+  explicit TMultiPutResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 1,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TMultiPutResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TMultiGetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TMultiGetRequest) */ {
+ public:
+  inline TMultiGetRequest() : TMultiGetRequest(nullptr) {}
+  ~TMultiGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR TMultiGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TMultiGetRequest(const TMultiGetRequest& from);
+  TMultiGetRequest(TMultiGetRequest&& from) noexcept
+    : TMultiGetRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TMultiGetRequest& operator=(const TMultiGetRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TMultiGetRequest& operator=(TMultiGetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TMultiGetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TMultiGetRequest* internal_default_instance() {
+    return reinterpret_cast<const TMultiGetRequest*>(
+               &_TMultiGetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(TMultiGetRequest& a, TMultiGetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TMultiGetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TMultiGetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TMultiGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TMultiGetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TMultiGetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TMultiGetRequest& from) {
+    TMultiGetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TMultiGetRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TMultiGetRequest";
+  }
+  protected:
+  explicit TMultiGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+  };
+  // repeated string keys = 2;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TMultiGetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TMultiGetResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TMultiGetResponse) */ {
+ public:
+  inline TMultiGetResponse() : TMultiGetResponse(nullptr) {}
+  ~TMultiGetResponse() override;
+  explicit PROTOBUF_CONSTEXPR TMultiGetResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TMultiGetResponse(const TMultiGetResponse& from);
+  TMultiGetResponse(TMultiGetResponse&& from) noexcept
+    : TMultiGetResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TMultiGetResponse& operator=(const TMultiGetResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TMultiGetResponse& operator=(TMultiGetResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TMultiGetResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TMultiGetResponse* internal_default_instance() {
+    return reinterpret_cast<const TMultiGetResponse*>(
+               &_TMultiGetResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TMultiGetResponse& a, TMultiGetResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TMultiGetResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TMultiGetResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TMultiGetResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TMultiGetResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TMultiGetResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TMultiGetResponse& from) {
+    TMultiGetResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TMultiGetResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TMultiGetResponse";
+  }
+  protected:
+  explicit TMultiGetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValuesFieldNumber = 2,
+    kRequestIdFieldNumber = 1,
+  };
+  // repeated string values = 2;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  const std::string& values(int index) const;
+  std::string* mutable_values(int index);
+  void set_values(int index, const std::string& value);
+  void set_values(int index, std::string&& value);
+  void set_values(int index, const char* value);
+  void set_values(int index, const char* value, size_t size);
+  std::string* add_values();
+  void add_values(const std::string& value);
+  void add_values(std::string&& value);
+  void add_values(const char* value);
+  void add_values(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_values();
+  private:
+  const std::string& _internal_values(int index) const;
+  std::string* _internal_add_values();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TMultiGetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> values_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TStatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TStatsRequest) */ {
+ public:
+  inline TStatsRequest() : TStatsRequest(nullptr) {}
+  ~TStatsRequest() override;
+  explicit PROTOBUF_CONSTEXPR TStatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TStatsRequest(const TStatsRequest& from);
+  TStatsRequest(TStatsRequest&& from) noexcept
+    : TStatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TStatsRequest& operator=(const TStatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TStatsRequest& operator=(TStatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TStatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TStatsRequest* internal_default_instance() {
+    return reinterpret_cast<const TStatsRequest*>(
+               &_TStatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(TStatsRequest& a, TStatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TStatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TStatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TStatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TStatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TStatsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TStatsRequest& from) {
+    TStatsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TStatsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TStatsRequest";
+  }
+  protected:
+  explicit TStatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 1,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TStatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TCounter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TCounter) */ {
+ public:
+  inline TCounter() : TCounter(nullptr) {}
+  ~TCounter() override;
+  explicit PROTOBUF_CONSTEXPR TCounter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TCounter(const TCounter& from);
+  TCounter(TCounter&& from) noexcept
+    : TCounter() {
+    *this = ::std::move(from);
+  }
+
+  inline TCounter& operator=(const TCounter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TCounter& operator=(TCounter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TCounter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TCounter* internal_default_instance() {
+    return reinterpret_cast<const TCounter*>(
+               &_TCounter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(TCounter& a, TCounter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TCounter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TCounter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TCounter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TCounter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TCounter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TCounter& from) {
+    TCounter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TCounter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TCounter";
+  }
+  protected:
+  explicit TCounter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 value = 2;
+  void clear_value();
+  uint64_t value() const;
+  void set_value(uint64_t value);
+  private:
+  uint64_t _internal_value() const;
+  void _internal_set_value(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TCounter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class THistogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.THistogram) */ {
+ public:
+  inline THistogram() : THistogram(nullptr) {}
+  ~THistogram() override;
+  explicit PROTOBUF_CONSTEXPR THistogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  THistogram(const THistogram& from);
+  THistogram(THistogram&& from) noexcept
+    : THistogram() {
+    *this = ::std::move(from);
+  }
+
+  inline THistogram& operator=(const THistogram& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline THistogram& operator=(THistogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const THistogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const THistogram* internal_default_instance() {
+    return reinterpret_cast<const THistogram*>(
+               &_THistogram_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(THistogram& a, THistogram& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(THistogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(THistogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  THistogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<THistogram>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const THistogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const THistogram& from) {
+    THistogram::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(THistogram* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.THistogram";
+  }
+  protected:
+  explicit THistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kMeanFieldNumber = 3,
+    kP50FieldNumber = 4,
+    kP99FieldNumber = 5,
+    kP999FieldNumber = 6,
+    kMaxFieldNumber = 7,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 mean = 3;
+  void clear_mean();
+  uint64_t mean() const;
+  void set_mean(uint64_t value);
+  private:
+  uint64_t _internal_mean() const;
+  void _internal_set_mean(uint64_t value);
+  public:
+
+  // uint64 p50 = 4;
+  void clear_p50();
+  uint64_t p50() const;
+  void set_p50(uint64_t value);
+  private:
+  uint64_t _internal_p50() const;
+  void _internal_set_p50(uint64_t value);
+  public:
+
+  // uint64 p99 = 5;
+  void clear_p99();
+  uint64_t p99() const;
+  void set_p99(uint64_t value);
+  private:
+  uint64_t _internal_p99() const;
+  void _internal_set_p99(uint64_t value);
+  public:
+
+  // uint64 p999 = 6;
+  void clear_p999();
+  uint64_t p999() const;
+  void set_p999(uint64_t value);
+  private:
+  uint64_t _internal_p999() const;
+  void _internal_set_p999(uint64_t value);
+  public:
+
+  // uint64 max = 7;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.THistogram)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t count_;
+    uint64_t mean_;
+    uint64_t p50_;
+    uint64_t p99_;
+    uint64_t p999_;
+    uint64_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TStatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TStatsResponse) */ {
+ public:
+  inline TStatsResponse() : TStatsResponse(nullptr) {}
+  ~TStatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR TStatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TStatsResponse(const TStatsResponse& from);
+  TStatsResponse(TStatsResponse&& from) noexcept
+    : TStatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TStatsResponse& operator=(const TStatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TStatsResponse& operator=(TStatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TStatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TStatsResponse* internal_default_instance() {
+    return reinterpret_cast<const TStatsResponse*>(
+               &_TStatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(TStatsResponse& a, TStatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TStatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TStatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TStatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TStatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TStatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TStatsResponse& from) {
+    TStatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TStatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TStatsResponse";
+  }
+  protected:
+  explicit TStatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountersFieldNumber = 2,
+    kHistogramsFieldNumber = 3,
+    kRequestIdFieldNumber = 1,
+  };
+  // repeated .NProto.TCounter counters = 2;
+  int counters_size() const;
+  private:
+  int _internal_counters_size() const;
+  public:
+  void clear_counters();
+  ::NProto::TCounter* mutable_counters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TCounter >*
+      mutable_counters();
+  private:
+  const ::NProto::TCounter& _internal_counters(int index) const;
+  ::NProto::TCounter* _internal_add_counters();
+  public:
+  const ::NProto::TCounter& counters(int index) const;
+  ::NProto::TCounter* add_counters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TCounter >&
+      counters() const;
+
+  // repeated .NProto.THistogram histograms = 3;
+  int histograms_size() const;
+  private:
+  int _internal_histograms_size() const;
+  public:
+  void clear_histograms();
+  ::NProto::THistogram* mutable_histograms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::THistogram >*
+      mutable_histograms();
+  private:
+  const ::NProto::THistogram& _internal_histograms(int index) const;
+  ::NProto::THistogram* _internal_add_histograms();
+  public:
+  const ::NProto::THistogram& histograms(int index) const;
+  ::NProto::THistogram* add_histograms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::THistogram >&
+      histograms() const;
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TStatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TCounter > counters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::THistogram > histograms_;
+    uint64_t request_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TScanRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TScanRequest) */ {
+ public:
+  inline TScanRequest() : TScanRequest(nullptr) {}
+  ~TScanRequest() override;
+  explicit PROTOBUF_CONSTEXPR TScanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TScanRequest(const TScanRequest& from);
+  TScanRequest(TScanRequest&& from) noexcept
+    : TScanRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TScanRequest& operator=(const TScanRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TScanRequest& operator=(TScanRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TScanRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TScanRequest* internal_default_instance() {
+    return reinterpret_cast<const TScanRequest*>(
+               &_TScanRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(TScanRequest& a, TScanRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TScanRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TScanRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TScanRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TScanRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TScanRequest& from) {
+    TScanRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TScanRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TScanRequest";
+  }
+  protected:
+  explicit TScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyFieldNumber = 2,
+    kEndKeyFieldNumber = 3,
+    kRequestIdFieldNumber = 1,
+    kLimitFieldNumber = 4,
+  };
+  // string start_key = 2;
+  void clear_start_key();
+  const std::string& start_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start_key();
+  PROTOBUF_NODISCARD std::string* release_start_key();
+  void set_allocated_start_key(std::string* start_key);
+  private:
+  const std::string& _internal_start_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start_key(const std::string& value);
+  std::string* _internal_mutable_start_key();
+  public:
+
+  // string end_key = 3;
+  void clear_end_key();
+  const std::string& end_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end_key();
+  PROTOBUF_NODISCARD std::string* release_end_key();
+  void set_allocated_end_key(std::string* end_key);
+  private:
+  const std::string& _internal_end_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end_key(const std::string& value);
+  std::string* _internal_mutable_end_key();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 limit = 4;
+  void clear_limit();
+  uint64_t limit() const;
+  void set_limit(uint64_t value);
+  private:
+  uint64_t _internal_limit() const;
+  void _internal_set_limit(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TScanRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_key_;
+    uint64_t request_id_;
+    uint64_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TScanResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TScanResponse) */ {
+ public:
+  inline TScanResponse() : TScanResponse(nullptr) {}
+  ~TScanResponse() override;
+  explicit PROTOBUF_CONSTEXPR TScanResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TScanResponse(const TScanResponse& from);
+  TScanResponse(TScanResponse&& from) noexcept
+    : TScanResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TScanResponse& operator=(const TScanResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TScanResponse& operator=(TScanResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TScanResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TScanResponse* internal_default_instance() {
+    return reinterpret_cast<const TScanResponse*>(
+               &_TScanResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(TScanResponse& a, TScanResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TScanResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TScanResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TScanResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TScanResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TScanResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TScanResponse& from) {
+    TScanResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TScanResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TScanResponse";
+  }
+  protected:
+  explicit TScanResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TScanResponse_EStatus EStatus;
+  static constexpr EStatus OK =
+    TScanResponse_EStatus_OK;
+  static constexpr EStatus UNSUPPORTED =
+    TScanResponse_EStatus_UNSUPPORTED;
+  static inline bool EStatus_IsValid(int value) {
+    return TScanResponse_EStatus_IsValid(value);
+  }
+  static constexpr EStatus EStatus_MIN =
+    TScanResponse_EStatus_EStatus_MIN;
+  static constexpr EStatus EStatus_MAX =
+    TScanResponse_EStatus_EStatus_MAX;
+  static constexpr int EStatus_ARRAYSIZE =
+    TScanResponse_EStatus_EStatus_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  EStatus_descriptor() {
+    return TScanResponse_EStatus_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& EStatus_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, EStatus>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function EStatus_Name.");
+    return TScanResponse_EStatus_Name(enum_t_value);
+  }
+  static inline bool EStatus_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      EStatus* value) {
+    return TScanResponse_EStatus_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvsFieldNumber = 2,
+    kNextKeyFieldNumber = 4,
+    kRequestIdFieldNumber = 1,
+    kLastFieldNumber = 3,
+    kStatusFieldNumber = 5,
+  };
+  // repeated .NProto.TKeyValue kvs = 2;
+  int kvs_size() const;
+  private:
+  int _internal_kvs_size() const;
+  public:
+  void clear_kvs();
+  ::NProto::TKeyValue* mutable_kvs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >*
+      mutable_kvs();
+  private:
+  const ::NProto::TKeyValue& _internal_kvs(int index) const;
+  ::NProto::TKeyValue* _internal_add_kvs();
+  public:
+  const ::NProto::TKeyValue& kvs(int index) const;
+  ::NProto::TKeyValue* add_kvs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >&
+      kvs() const;
+
+  // string next_key = 4;
+  void clear_next_key();
+  const std::string& next_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_key();
+  PROTOBUF_NODISCARD std::string* release_next_key();
+  void set_allocated_next_key(std::string* next_key);
+  private:
+  const std::string& _internal_next_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_key(const std::string& value);
+  std::string* _internal_mutable_next_key();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // bool last = 3;
+  void clear_last();
+  bool last() const;
+  void set_last(bool value);
+  private:
+  bool _internal_last() const;
+  void _internal_set_last(bool value);
+  public:
+
+  // .NProto.TScanResponse.EStatus status = 5;
+  void clear_status();
+  ::NProto::TScanResponse_EStatus status() const;
+  void set_status(::NProto::TScanResponse_EStatus value);
+  private:
+  ::NProto::TScanResponse_EStatus _internal_status() const;
+  void _internal_set_status(::NProto::TScanResponse_EStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TScanResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue > kvs_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_key_;
+    uint64_t request_id_;
+    bool last_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TReplicateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TReplicateRequest) */ {
+ public:
+  inline TReplicateRequest() : TReplicateRequest(nullptr) {}
+  ~TReplicateRequest() override;
+  explicit PROTOBUF_CONSTEXPR TReplicateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TReplicateRequest(const TReplicateRequest& from);
+  TReplicateRequest(TReplicateRequest&& from) noexcept
+    : TReplicateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TReplicateRequest& operator=(const TReplicateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TReplicateRequest& operator=(TReplicateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TReplicateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TReplicateRequest* internal_default_instance() {
+    return reinterpret_cast<const TReplicateRequest*>(
+               &_TReplicateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TReplicateRequest& a, TReplicateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TReplicateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TReplicateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TReplicateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TReplicateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TReplicateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TReplicateRequest& from) {
+    TReplicateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TReplicateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TReplicateRequest";
+  }
+  protected:
+  explicit TReplicateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 1,
+    kStreamIdFieldNumber = 2,
+    kPositionFieldNumber = 3,
+    kMaxBytesFieldNumber = 4,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 stream_id = 2;
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
+
+  // uint64 position = 3;
+  void clear_position();
+  uint64_t position() const;
+  void set_position(uint64_t value);
+  private:
+  uint64_t _internal_position() const;
+  void _internal_set_position(uint64_t value);
+  public:
+
+  // uint64 max_bytes = 4;
+  void clear_max_bytes();
+  uint64_t max_bytes() const;
+  void set_max_bytes(uint64_t value);
+  private:
+  uint64_t _internal_max_bytes() const;
+  void _internal_set_max_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TReplicateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    uint64_t stream_id_;
+    uint64_t position_;
+    uint64_t max_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TReplicateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NProto.TReplicateResponse) */ {
+ public:
+  inline TReplicateResponse() : TReplicateResponse(nullptr) {}
+  ~TReplicateResponse() override;
+  explicit PROTOBUF_CONSTEXPR TReplicateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TReplicateResponse(const TReplicateResponse& from);
+  TReplicateResponse(TReplicateResponse&& from) noexcept
+    : TReplicateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TReplicateResponse& operator=(const TReplicateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TReplicateResponse& operator=(TReplicateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TReplicateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TReplicateResponse* internal_default_instance() {
+    return reinterpret_cast<const TReplicateResponse*>(
+               &_TReplicateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TReplicateResponse& a, TReplicateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TReplicateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TReplicateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TReplicateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TReplicateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TReplicateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TReplicateResponse& from) {
+    TReplicateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TReplicateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "NProto.TReplicateResponse";
+  }
+  protected:
+  explicit TReplicateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecordsFieldNumber = 4,
+    kRequestIdFieldNumber = 1,
+    kStreamIdFieldNumber = 2,
+    kEndPositionFieldNumber = 5,
+    kFoundFieldNumber = 3,
+  };
+  // bytes records = 4;
+  void clear_records();
+  const std::string& records() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_records(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_records();
+  PROTOBUF_NODISCARD std::string* release_records();
+  void set_allocated_records(std::string* records);
+  private:
+  const std::string& _internal_records() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_records(const std::string& value);
+  std::string* _internal_mutable_records();
+  public:
+
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 stream_id = 2;
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
+
+  // uint64 end_position = 5;
+  void clear_end_position();
+  uint64_t end_position() const;
+  void set_end_position(uint64_t value);
+  private:
+  uint64_t _internal_end_position() const;
+  void _internal_set_end_position(uint64_t value);
+  public:
+
+  // bool found = 3;
+  void clear_found();
+  bool found() const;
+  void set_found(bool value);
+  private:
+  bool _internal_found() const;
+  void _internal_set_found(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:NProto.TReplicateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr records_;
+    uint64_t request_id_;
+    uint64_t stream_id_;
+    uint64_t end_position_;
+    bool found_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kv_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TPutNumberRequest
+
+// uint64 request_id = 1;
+inline void TPutNumberRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TPutNumberRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TPutNumberRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutNumberRequest.request_id)
+  return _internal_request_id();
+}
+inline void TPutNumberRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TPutNumberRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TPutNumberRequest.request_id)
+}
+
+// string key = 2;
+inline void TPutNumberRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TPutNumberRequest::key() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutNumberRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TPutNumberRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TPutNumberRequest.key)
+}
+inline std::string* TPutNumberRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TPutNumberRequest.key)
+  return _s;
+}
+inline const std::string& TPutNumberRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TPutNumberRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TPutNumberRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TPutNumberRequest::release_key() {
+  // @@protoc_insertion_point(field_release:NProto.TPutNumberRequest.key)
+  return _impl_.key_.Release();
+}
+inline void TPutNumberRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TPutNumberRequest.key)
+}
+
+// uint64 offset = 3;
+inline void TPutNumberRequest::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t TPutNumberRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t TPutNumberRequest::offset() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutNumberRequest.offset)
+  return _internal_offset();
+}
+inline void TPutNumberRequest::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void TPutNumberRequest::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:NProto.TPutNumberRequest.offset)
+}
+
+// -------------------------------------------------------------------
+
+// TPutNumberResponse
+
+// uint64 request_id = 1;
+inline void TPutNumberResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TPutNumberResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TPutNumberResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutNumberResponse.request_id)
+  return _internal_request_id();
+}
+inline void TPutNumberResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TPutNumberResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TPutNumberResponse.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// TGetNumberRequest
+
+// uint64 request_id = 1;
+inline void TGetNumberRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TGetNumberRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TGetNumberRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetNumberRequest.request_id)
+  return _internal_request_id();
+}
+inline void TGetNumberRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TGetNumberRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TGetNumberRequest.request_id)
+}
+
+// string key = 2;
+inline void TGetNumberRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TGetNumberRequest::key() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetNumberRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TGetNumberRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TGetNumberRequest.key)
+}
+inline std::string* TGetNumberRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TGetNumberRequest.key)
+  return _s;
+}
+inline const std::string& TGetNumberRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TGetNumberRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TGetNumberRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TGetNumberRequest::release_key() {
+  // @@protoc_insertion_point(field_release:NProto.TGetNumberRequest.key)
+  return _impl_.key_.Release();
+}
+inline void TGetNumberRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TGetNumberRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// TGetNumberResponse
+
+// uint64 request_id = 1;
+inline void TGetNumberResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TGetNumberResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TGetNumberResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetNumberResponse.request_id)
+  return _internal_request_id();
+}
+inline void TGetNumberResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TGetNumberResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TGetNumberResponse.request_id)
+}
+
+// uint64 offset = 2;
+inline void TGetNumberResponse::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t TGetNumberResponse::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t TGetNumberResponse::offset() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetNumberResponse.offset)
+  return _internal_offset();
+}
+inline void TGetNumberResponse::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void TGetNumberResponse::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:NProto.TGetNumberResponse.offset)
+}
+
+// -------------------------------------------------------------------
+
+// TPutRequest
+
+// uint64 request_id = 1;
+inline void TPutRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TPutRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TPutRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutRequest.request_id)
+  return _internal_request_id();
+}
+inline void TPutRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TPutRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TPutRequest.request_id)
+}
+
+// string key = 2;
+inline void TPutRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TPutRequest::key() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TPutRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TPutRequest.key)
+}
+inline std::string* TPutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TPutRequest.key)
+  return _s;
+}
+inline const std::string& TPutRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TPutRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TPutRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TPutRequest::release_key() {
+  // @@protoc_insertion_point(field_release:NProto.TPutRequest.key)
+  return _impl_.key_.Release();
+}
+inline void TPutRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TPutRequest.key)
+}
+
+// string value = 3;
+inline void TPutRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TPutRequest::value() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TPutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TPutRequest.value)
+}
+inline std::string* TPutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:NProto.TPutRequest.value)
+  return _s;
+}
+inline const std::string& TPutRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TPutRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TPutRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TPutRequest::release_value() {
+  // @@protoc_insertion_point(field_release:NProto.TPutRequest.value)
+  return _impl_.value_.Release();
+}
+inline void TPutRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TPutRequest.value)
+}
+
+// -------------------------------------------------------------------
+
+// TPutResponse
+
+// uint64 request_id = 1;
+inline void TPutResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TPutResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TPutResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TPutResponse.request_id)
+  return _internal_request_id();
+}
+inline void TPutResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TPutResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TPutResponse.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// TGetRequest
+
+// uint64 request_id = 1;
+inline void TGetRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TGetRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TGetRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetRequest.request_id)
+  return _internal_request_id();
+}
+inline void TGetRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TGetRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TGetRequest.request_id)
+}
+
+// string key = 2;
+inline void TGetRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TGetRequest::key() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TGetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TGetRequest.key)
+}
+inline std::string* TGetRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TGetRequest.key)
+  return _s;
+}
+inline const std::string& TGetRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TGetRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TGetRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TGetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:NProto.TGetRequest.key)
+  return _impl_.key_.Release();
+}
+inline void TGetRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TGetRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// TGetResponse
+
+// uint64 request_id = 1;
+inline void TGetResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TGetResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TGetResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetResponse.request_id)
+  return _internal_request_id();
+}
+inline void TGetResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TGetResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TGetResponse.request_id)
+}
+
+// string value = 2;
+inline void TGetResponse::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TGetResponse::value() const {
+  // @@protoc_insertion_point(field_get:NProto.TGetResponse.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TGetResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TGetResponse.value)
+}
+inline std::string* TGetResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:NProto.TGetResponse.value)
+  return _s;
+}
+inline const std::string& TGetResponse::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TGetResponse::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TGetResponse::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TGetResponse::release_value() {
+  // @@protoc_insertion_point(field_release:NProto.TGetResponse.value)
+  return _impl_.value_.Release();
+}
+inline void TGetResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TGetResponse.value)
+}
+
+// -------------------------------------------------------------------
+
+// TKeyValue
+
+// string key = 1;
+inline void TKeyValue::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& TKeyValue::key() const {
+  // @@protoc_insertion_point(field_get:NProto.TKeyValue.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TKeyValue::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TKeyValue.key)
+}
+inline std::string* TKeyValue::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TKeyValue.key)
+  return _s;
+}
+inline const std::string& TKeyValue::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void TKeyValue::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TKeyValue::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TKeyValue::release_key() {
+  // @@protoc_insertion_point(field_release:NProto.TKeyValue.key)
+  return _impl_.key_.Release();
+}
+inline void TKeyValue::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TKeyValue.key)
+}
+
+// string value = 2;
+inline void TKeyValue::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& TKeyValue::value() const {
+  // @@protoc_insertion_point(field_get:NProto.TKeyValue.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TKeyValue::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TKeyValue.value)
+}
+inline std::string* TKeyValue::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:NProto.TKeyValue.value)
+  return _s;
+}
+inline const std::string& TKeyValue::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void TKeyValue::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TKeyValue::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TKeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:NProto.TKeyValue.value)
+  return _impl_.value_.Release();
+}
+inline void TKeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TKeyValue.value)
+}
+
+// -------------------------------------------------------------------
+
+// TMultiPutRequest
+
+// uint64 request_id = 1;
+inline void TMultiPutRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TMultiPutRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TMultiPutRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiPutRequest.request_id)
+  return _internal_request_id();
+}
+inline void TMultiPutRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TMultiPutRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TMultiPutRequest.request_id)
+}
+
+// repeated .NProto.TKeyValue kvs = 2;
+inline int TMultiPutRequest::_internal_kvs_size() const {
+  return _impl_.kvs_.size();
+}
+inline int TMultiPutRequest::kvs_size() const {
+  return _internal_kvs_size();
+}
+inline void TMultiPutRequest::clear_kvs() {
+  _impl_.kvs_.Clear();
+}
+inline ::NProto::TKeyValue* TMultiPutRequest::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:NProto.TMultiPutRequest.kvs)
+  return _impl_.kvs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >*
+TMultiPutRequest::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:NProto.TMultiPutRequest.kvs)
+  return &_impl_.kvs_;
+}
+inline const ::NProto::TKeyValue& TMultiPutRequest::_internal_kvs(int index) const {
+  return _impl_.kvs_.Get(index);
+}
+inline const ::NProto::TKeyValue& TMultiPutRequest::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiPutRequest.kvs)
+  return _internal_kvs(index);
+}
+inline ::NProto::TKeyValue* TMultiPutRequest::_internal_add_kvs() {
+  return _impl_.kvs_.Add();
+}
+inline ::NProto::TKeyValue* TMultiPutRequest::add_kvs() {
+  ::NProto::TKeyValue* _add = _internal_add_kvs();
+  // @@protoc_insertion_point(field_add:NProto.TMultiPutRequest.kvs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >&
+TMultiPutRequest::kvs() const {
+  // @@protoc_insertion_point(field_list:NProto.TMultiPutRequest.kvs)
+  return _impl_.kvs_;
+}
+
+// -------------------------------------------------------------------
+
+// TMultiPutResponse
+
+// uint64 request_id = 1;
+inline void TMultiPutResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TMultiPutResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TMultiPutResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiPutResponse.request_id)
+  return _internal_request_id();
+}
+inline void TMultiPutResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TMultiPutResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TMultiPutResponse.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// TMultiGetRequest
+
+// uint64 request_id = 1;
+inline void TMultiGetRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TMultiGetRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TMultiGetRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiGetRequest.request_id)
+  return _internal_request_id();
+}
+inline void TMultiGetRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TMultiGetRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TMultiGetRequest.request_id)
+}
+
+// repeated string keys = 2;
+inline int TMultiGetRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int TMultiGetRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void TMultiGetRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* TMultiGetRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:NProto.TMultiGetRequest.keys)
+  return _s;
+}
+inline const std::string& TMultiGetRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& TMultiGetRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiGetRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* TMultiGetRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:NProto.TMultiGetRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void TMultiGetRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NProto.TMultiGetRequest.keys)
+}
+inline void TMultiGetRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NProto.TMultiGetRequest.keys)
+}
+inline void TMultiGetRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NProto.TMultiGetRequest.keys)
+}
+inline void TMultiGetRequest::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NProto.TMultiGetRequest.keys)
+}
+inline std::string* TMultiGetRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void TMultiGetRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NProto.TMultiGetRequest.keys)
+}
+inline void TMultiGetRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NProto.TMultiGetRequest.keys)
+}
+inline void TMultiGetRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NProto.TMultiGetRequest.keys)
+}
+inline void TMultiGetRequest::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NProto.TMultiGetRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TMultiGetRequest::keys() const {
+  // @@protoc_insertion_point(field_list:NProto.TMultiGetRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TMultiGetRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:NProto.TMultiGetRequest.keys)
+  return &_impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// TMultiGetResponse
+
+// uint64 request_id = 1;
+inline void TMultiGetResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TMultiGetResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TMultiGetResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiGetResponse.request_id)
+  return _internal_request_id();
+}
+inline void TMultiGetResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TMultiGetResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TMultiGetResponse.request_id)
+}
+
+// repeated string values = 2;
+inline int TMultiGetResponse::_internal_values_size() const {
+  return _impl_.values_.size();
+}
+inline int TMultiGetResponse::values_size() const {
+  return _internal_values_size();
+}
+inline void TMultiGetResponse::clear_values() {
+  _impl_.values_.Clear();
+}
+inline std::string* TMultiGetResponse::add_values() {
+  std::string* _s = _internal_add_values();
+  // @@protoc_insertion_point(field_add_mutable:NProto.TMultiGetResponse.values)
+  return _s;
+}
+inline const std::string& TMultiGetResponse::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
+}
+inline const std::string& TMultiGetResponse::values(int index) const {
+  // @@protoc_insertion_point(field_get:NProto.TMultiGetResponse.values)
+  return _internal_values(index);
+}
+inline std::string* TMultiGetResponse::mutable_values(int index) {
+  // @@protoc_insertion_point(field_mutable:NProto.TMultiGetResponse.values)
+  return _impl_.values_.Mutable(index);
+}
+inline void TMultiGetResponse::set_values(int index, const std::string& value) {
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:NProto.TMultiGetResponse.values)
+}
+inline void TMultiGetResponse::set_values(int index, std::string&& value) {
+  _impl_.values_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:NProto.TMultiGetResponse.values)
+}
+inline void TMultiGetResponse::set_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:NProto.TMultiGetResponse.values)
+}
+inline void TMultiGetResponse::set_values(int index, const char* value, size_t size) {
+  _impl_.values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:NProto.TMultiGetResponse.values)
+}
+inline std::string* TMultiGetResponse::_internal_add_values() {
+  return _impl_.values_.Add();
+}
+inline void TMultiGetResponse::add_values(const std::string& value) {
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:NProto.TMultiGetResponse.values)
+}
+inline void TMultiGetResponse::add_values(std::string&& value) {
+  _impl_.values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:NProto.TMultiGetResponse.values)
+}
+inline void TMultiGetResponse::add_values(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:NProto.TMultiGetResponse.values)
+}
+inline void TMultiGetResponse::add_values(const char* value, size_t size) {
+  _impl_.values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:NProto.TMultiGetResponse.values)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TMultiGetResponse::values() const {
+  // @@protoc_insertion_point(field_list:NProto.TMultiGetResponse.values)
+  return _impl_.values_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TMultiGetResponse::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:NProto.TMultiGetResponse.values)
+  return &_impl_.values_;
+}
+
+// -------------------------------------------------------------------
+
+// TStatsRequest
+
+// uint64 request_id = 1;
+inline void TStatsRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TStatsRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TStatsRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TStatsRequest.request_id)
+  return _internal_request_id();
+}
+inline void TStatsRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TStatsRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TStatsRequest.request_id)
+}
+
+// -------------------------------------------------------------------
+
+// TCounter
+
+// string name = 1;
+inline void TCounter::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& TCounter::name() const {
+  // @@protoc_insertion_point(field_get:NProto.TCounter.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TCounter::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TCounter.name)
+}
+inline std::string* TCounter::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:NProto.TCounter.name)
+  return _s;
+}
+inline const std::string& TCounter::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TCounter::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TCounter::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TCounter::release_name() {
+  // @@protoc_insertion_point(field_release:NProto.TCounter.name)
+  return _impl_.name_.Release();
+}
+inline void TCounter::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TCounter.name)
+}
+
+// uint64 value = 2;
+inline void TCounter::clear_value() {
+  _impl_.value_ = uint64_t{0u};
+}
+inline uint64_t TCounter::_internal_value() const {
+  return _impl_.value_;
+}
+inline uint64_t TCounter::value() const {
+  // @@protoc_insertion_point(field_get:NProto.TCounter.value)
+  return _internal_value();
+}
+inline void TCounter::_internal_set_value(uint64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void TCounter::set_value(uint64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:NProto.TCounter.value)
+}
+
+// -------------------------------------------------------------------
+
+// THistogram
+
+// string name = 1;
+inline void THistogram::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& THistogram::name() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void THistogram::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.THistogram.name)
+}
+inline std::string* THistogram::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:NProto.THistogram.name)
+  return _s;
+}
+inline const std::string& THistogram::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void THistogram::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* THistogram::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* THistogram::release_name() {
+  // @@protoc_insertion_point(field_release:NProto.THistogram.name)
+  return _impl_.name_.Release();
+}
+inline void THistogram::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.THistogram.name)
+}
+
+// uint64 count = 2;
+inline void THistogram::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t THistogram::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t THistogram::count() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.count)
+  return _internal_count();
+}
+inline void THistogram::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void THistogram::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:NProto.THistogram.count)
+}
+
+// uint64 mean = 3;
+inline void THistogram::clear_mean() {
+  _impl_.mean_ = uint64_t{0u};
+}
+inline uint64_t THistogram::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline uint64_t THistogram::mean() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.mean)
+  return _internal_mean();
+}
+inline void THistogram::_internal_set_mean(uint64_t value) {
+  
+  _impl_.mean_ = value;
+}
+inline void THistogram::set_mean(uint64_t value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:NProto.THistogram.mean)
+}
+
+// uint64 p50 = 4;
+inline void THistogram::clear_p50() {
+  _impl_.p50_ = uint64_t{0u};
+}
+inline uint64_t THistogram::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline uint64_t THistogram::p50() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.p50)
+  return _internal_p50();
+}
+inline void THistogram::_internal_set_p50(uint64_t value) {
+  
+  _impl_.p50_ = value;
+}
+inline void THistogram::set_p50(uint64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:NProto.THistogram.p50)
+}
+
+// uint64 p99 = 5;
+inline void THistogram::clear_p99() {
+  _impl_.p99_ = uint64_t{0u};
+}
+inline uint64_t THistogram::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline uint64_t THistogram::p99() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.p99)
+  return _internal_p99();
+}
+inline void THistogram::_internal_set_p99(uint64_t value) {
+  
+  _impl_.p99_ = value;
+}
+inline void THistogram::set_p99(uint64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:NProto.THistogram.p99)
+}
+
+// uint64 p999 = 6;
+inline void THistogram::clear_p999() {
+  _impl_.p999_ = uint64_t{0u};
+}
+inline uint64_t THistogram::_internal_p999() const {
+  return _impl_.p999_;
+}
+inline uint64_t THistogram::p999() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.p999)
+  return _internal_p999();
+}
+inline void THistogram::_internal_set_p999(uint64_t value) {
+  
+  _impl_.p999_ = value;
+}
+inline void THistogram::set_p999(uint64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:NProto.THistogram.p999)
+}
+
+// uint64 max = 7;
+inline void THistogram::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t THistogram::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t THistogram::max() const {
+  // @@protoc_insertion_point(field_get:NProto.THistogram.max)
+  return _internal_max();
+}
+inline void THistogram::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void THistogram::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:NProto.THistogram.max)
+}
+
+// -------------------------------------------------------------------
+
+// TStatsResponse
+
+// uint64 request_id = 1;
+inline void TStatsResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TStatsResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TStatsResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TStatsResponse.request_id)
+  return _internal_request_id();
+}
+inline void TStatsResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TStatsResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TStatsResponse.request_id)
+}
+
+// repeated .NProto.TCounter counters = 2;
+inline int TStatsResponse::_internal_counters_size() const {
+  return _impl_.counters_.size();
+}
+inline int TStatsResponse::counters_size() const {
+  return _internal_counters_size();
+}
+inline void TStatsResponse::clear_counters() {
+  _impl_.counters_.Clear();
+}
+inline ::NProto::TCounter* TStatsResponse::mutable_counters(int index) {
+  // @@protoc_insertion_point(field_mutable:NProto.TStatsResponse.counters)
+  return _impl_.counters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TCounter >*
+TStatsResponse::mutable_counters() {
+  // @@protoc_insertion_point(field_mutable_list:NProto.TStatsResponse.counters)
+  return &_impl_.counters_;
+}
+inline const ::NProto::TCounter& TStatsResponse::_internal_counters(int index) const {
+  return _impl_.counters_.Get(index);
+}
+inline const ::NProto::TCounter& TStatsResponse::counters(int index) const {
+  // @@protoc_insertion_point(field_get:NProto.TStatsResponse.counters)
+  return _internal_counters(index);
+}
+inline ::NProto::TCounter* TStatsResponse::_internal_add_counters() {
+  return _impl_.counters_.Add();
+}
+inline ::NProto::TCounter* TStatsResponse::add_counters() {
+  ::NProto::TCounter* _add = _internal_add_counters();
+  // @@protoc_insertion_point(field_add:NProto.TStatsResponse.counters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TCounter >&
+TStatsResponse::counters() const {
+  // @@protoc_insertion_point(field_list:NProto.TStatsResponse.counters)
+  return _impl_.counters_;
+}
+
+// repeated .NProto.THistogram histograms = 3;
+inline int TStatsResponse::_internal_histograms_size() const {
+  return _impl_.histograms_.size();
+}
+inline int TStatsResponse::histograms_size() const {
+  return _internal_histograms_size();
+}
+inline void TStatsResponse::clear_histograms() {
+  _impl_.histograms_.Clear();
+}
+inline ::NProto::THistogram* TStatsResponse::mutable_histograms(int index) {
+  // @@protoc_insertion_point(field_mutable:NProto.TStatsResponse.histograms)
+  return _impl_.histograms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::THistogram >*
+TStatsResponse::mutable_histograms() {
+  // @@protoc_insertion_point(field_mutable_list:NProto.TStatsResponse.histograms)
+  return &_impl_.histograms_;
+}
+inline const ::NProto::THistogram& TStatsResponse::_internal_histograms(int index) const {
+  return _impl_.histograms_.Get(index);
+}
+inline const ::NProto::THistogram& TStatsResponse::histograms(int index) const {
+  // @@protoc_insertion_point(field_get:NProto.TStatsResponse.histograms)
+  return _internal_histograms(index);
+}
+inline ::NProto::THistogram* TStatsResponse::_internal_add_histograms() {
+  return _impl_.histograms_.Add();
+}
+inline ::NProto::THistogram* TStatsResponse::add_histograms() {
+  ::NProto::THistogram* _add = _internal_add_histograms();
+  // @@protoc_insertion_point(field_add:NProto.TStatsResponse.histograms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::THistogram >&
+TStatsResponse::histograms() const {
+  // @@protoc_insertion_point(field_list:NProto.TStatsResponse.histograms)
+  return _impl_.histograms_;
+}
+
+// -------------------------------------------------------------------
+
+// TScanRequest
+
+// uint64 request_id = 1;
+inline void TScanRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TScanRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TScanRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanRequest.request_id)
+  return _internal_request_id();
+}
+inline void TScanRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TScanRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TScanRequest.request_id)
+}
+
+// string start_key = 2;
+inline void TScanRequest::clear_start_key() {
+  _impl_.start_key_.ClearToEmpty();
+}
+inline const std::string& TScanRequest::start_key() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanRequest.start_key)
+  return _internal_start_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TScanRequest::set_start_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TScanRequest.start_key)
+}
+inline std::string* TScanRequest::mutable_start_key() {
+  std::string* _s = _internal_mutable_start_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TScanRequest.start_key)
+  return _s;
+}
+inline const std::string& TScanRequest::_internal_start_key() const {
+  return _impl_.start_key_.Get();
+}
+inline void TScanRequest::_internal_set_start_key(const std::string& value) {
+  
+  _impl_.start_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TScanRequest::_internal_mutable_start_key() {
+  
+  return _impl_.start_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TScanRequest::release_start_key() {
+  // @@protoc_insertion_point(field_release:NProto.TScanRequest.start_key)
+  return _impl_.start_key_.Release();
+}
+inline void TScanRequest::set_allocated_start_key(std::string* start_key) {
+  if (start_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.start_key_.SetAllocated(start_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_key_.IsDefault()) {
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TScanRequest.start_key)
+}
+
+// string end_key = 3;
+inline void TScanRequest::clear_end_key() {
+  _impl_.end_key_.ClearToEmpty();
+}
+inline const std::string& TScanRequest::end_key() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanRequest.end_key)
+  return _internal_end_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TScanRequest::set_end_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TScanRequest.end_key)
+}
+inline std::string* TScanRequest::mutable_end_key() {
+  std::string* _s = _internal_mutable_end_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TScanRequest.end_key)
+  return _s;
+}
+inline const std::string& TScanRequest::_internal_end_key() const {
+  return _impl_.end_key_.Get();
+}
+inline void TScanRequest::_internal_set_end_key(const std::string& value) {
+  
+  _impl_.end_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TScanRequest::_internal_mutable_end_key() {
+  
+  return _impl_.end_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TScanRequest::release_end_key() {
+  // @@protoc_insertion_point(field_release:NProto.TScanRequest.end_key)
+  return _impl_.end_key_.Release();
+}
+inline void TScanRequest::set_allocated_end_key(std::string* end_key) {
+  if (end_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.end_key_.SetAllocated(end_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_key_.IsDefault()) {
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TScanRequest.end_key)
+}
+
+// uint64 limit = 4;
+inline void TScanRequest::clear_limit() {
+  _impl_.limit_ = uint64_t{0u};
+}
+inline uint64_t TScanRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint64_t TScanRequest::limit() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanRequest.limit)
+  return _internal_limit();
+}
+inline void TScanRequest::_internal_set_limit(uint64_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void TScanRequest::set_limit(uint64_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:NProto.TScanRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// TScanResponse
+
+// uint64 request_id = 1;
+inline void TScanResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TScanResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TScanResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanResponse.request_id)
+  return _internal_request_id();
+}
+inline void TScanResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TScanResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TScanResponse.request_id)
+}
+
+// repeated .NProto.TKeyValue kvs = 2;
+inline int TScanResponse::_internal_kvs_size() const {
+  return _impl_.kvs_.size();
+}
+inline int TScanResponse::kvs_size() const {
+  return _internal_kvs_size();
+}
+inline void TScanResponse::clear_kvs() {
+  _impl_.kvs_.Clear();
+}
+inline ::NProto::TKeyValue* TScanResponse::mutable_kvs(int index) {
+  // @@protoc_insertion_point(field_mutable:NProto.TScanResponse.kvs)
+  return _impl_.kvs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >*
+TScanResponse::mutable_kvs() {
+  // @@protoc_insertion_point(field_mutable_list:NProto.TScanResponse.kvs)
+  return &_impl_.kvs_;
+}
+inline const ::NProto::TKeyValue& TScanResponse::_internal_kvs(int index) const {
+  return _impl_.kvs_.Get(index);
+}
+inline const ::NProto::TKeyValue& TScanResponse::kvs(int index) const {
+  // @@protoc_insertion_point(field_get:NProto.TScanResponse.kvs)
+  return _internal_kvs(index);
+}
+inline ::NProto::TKeyValue* TScanResponse::_internal_add_kvs() {
+  return _impl_.kvs_.Add();
+}
+inline ::NProto::TKeyValue* TScanResponse::add_kvs() {
+  ::NProto::TKeyValue* _add = _internal_add_kvs();
+  // @@protoc_insertion_point(field_add:NProto.TScanResponse.kvs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::NProto::TKeyValue >&
+TScanResponse::kvs() const {
+  // @@protoc_insertion_point(field_list:NProto.TScanResponse.kvs)
+  return _impl_.kvs_;
+}
+
+// bool last = 3;
+inline void TScanResponse::clear_last() {
+  _impl_.last_ = false;
+}
+inline bool TScanResponse::_internal_last() const {
+  return _impl_.last_;
+}
+inline bool TScanResponse::last() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanResponse.last)
+  return _internal_last();
+}
+inline void TScanResponse::_internal_set_last(bool value) {
+  
+  _impl_.last_ = value;
+}
+inline void TScanResponse::set_last(bool value) {
+  _internal_set_last(value);
+  // @@protoc_insertion_point(field_set:NProto.TScanResponse.last)
+}
+
+// string next_key = 4;
+inline void TScanResponse::clear_next_key() {
+  _impl_.next_key_.ClearToEmpty();
+}
+inline const std::string& TScanResponse::next_key() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanResponse.next_key)
+  return _internal_next_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TScanResponse::set_next_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.next_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TScanResponse.next_key)
+}
+inline std::string* TScanResponse::mutable_next_key() {
+  std::string* _s = _internal_mutable_next_key();
+  // @@protoc_insertion_point(field_mutable:NProto.TScanResponse.next_key)
+  return _s;
+}
+inline const std::string& TScanResponse::_internal_next_key() const {
+  return _impl_.next_key_.Get();
+}
+inline void TScanResponse::_internal_set_next_key(const std::string& value) {
+  
+  _impl_.next_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TScanResponse::_internal_mutable_next_key() {
+  
+  return _impl_.next_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TScanResponse::release_next_key() {
+  // @@protoc_insertion_point(field_release:NProto.TScanResponse.next_key)
+  return _impl_.next_key_.Release();
+}
+inline void TScanResponse::set_allocated_next_key(std::string* next_key) {
+  if (next_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.next_key_.SetAllocated(next_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_key_.IsDefault()) {
+    _impl_.next_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TScanResponse.next_key)
+}
+
+// .NProto.TScanResponse.EStatus status = 5;
+inline void TScanResponse::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::NProto::TScanResponse_EStatus TScanResponse::_internal_status() const {
+  return static_cast< ::NProto::TScanResponse_EStatus >(_impl_.status_);
+}
+inline ::NProto::TScanResponse_EStatus TScanResponse::status() const {
+  // @@protoc_insertion_point(field_get:NProto.TScanResponse.status)
+  return _internal_status();
+}
+inline void TScanResponse::_internal_set_status(::NProto::TScanResponse_EStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void TScanResponse::set_status(::NProto::TScanResponse_EStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:NProto.TScanResponse.status)
+}
+
+// -------------------------------------------------------------------
+
+// TReplicateRequest
+
+// uint64 request_id = 1;
+inline void TReplicateRequest::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TReplicateRequest::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TReplicateRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateRequest.request_id)
+  return _internal_request_id();
+}
+inline void TReplicateRequest::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TReplicateRequest::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateRequest.request_id)
+}
+
+// uint64 stream_id = 2;
+inline void TReplicateRequest::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+}
+inline uint64_t TReplicateRequest::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint64_t TReplicateRequest::stream_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateRequest.stream_id)
+  return _internal_stream_id();
+}
+inline void TReplicateRequest::_internal_set_stream_id(uint64_t value) {
+  
+  _impl_.stream_id_ = value;
+}
+inline void TReplicateRequest::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateRequest.stream_id)
+}
+
+// uint64 position = 3;
+inline void TReplicateRequest::clear_position() {
+  _impl_.position_ = uint64_t{0u};
+}
+inline uint64_t TReplicateRequest::_internal_position() const {
+  return _impl_.position_;
+}
+inline uint64_t TReplicateRequest::position() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateRequest.position)
+  return _internal_position();
+}
+inline void TReplicateRequest::_internal_set_position(uint64_t value) {
+  
+  _impl_.position_ = value;
+}
+inline void TReplicateRequest::set_position(uint64_t value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateRequest.position)
+}
+
+// uint64 max_bytes = 4;
+inline void TReplicateRequest::clear_max_bytes() {
+  _impl_.max_bytes_ = uint64_t{0u};
+}
+inline uint64_t TReplicateRequest::_internal_max_bytes() const {
+  return _impl_.max_bytes_;
+}
+inline uint64_t TReplicateRequest::max_bytes() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateRequest.max_bytes)
+  return _internal_max_bytes();
+}
+inline void TReplicateRequest::_internal_set_max_bytes(uint64_t value) {
+  
+  _impl_.max_bytes_ = value;
+}
+inline void TReplicateRequest::set_max_bytes(uint64_t value) {
+  _internal_set_max_bytes(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateRequest.max_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// TReplicateResponse
+
+// uint64 request_id = 1;
+inline void TReplicateResponse::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t TReplicateResponse::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t TReplicateResponse::request_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateResponse.request_id)
+  return _internal_request_id();
+}
+inline void TReplicateResponse::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void TReplicateResponse::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateResponse.request_id)
+}
+
+// uint64 stream_id = 2;
+inline void TReplicateResponse::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+}
+inline uint64_t TReplicateResponse::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint64_t TReplicateResponse::stream_id() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateResponse.stream_id)
+  return _internal_stream_id();
+}
+inline void TReplicateResponse::_internal_set_stream_id(uint64_t value) {
+  
+  _impl_.stream_id_ = value;
+}
+inline void TReplicateResponse::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateResponse.stream_id)
+}
+
+// bool found = 3;
+inline void TReplicateResponse::clear_found() {
+  _impl_.found_ = false;
+}
+inline bool TReplicateResponse::_internal_found() const {
+  return _impl_.found_;
+}
+inline bool TReplicateResponse::found() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateResponse.found)
+  return _internal_found();
+}
+inline void TReplicateResponse::_internal_set_found(bool value) {
+  
+  _impl_.found_ = value;
+}
+inline void TReplicateResponse::set_found(bool value) {
+  _internal_set_found(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateResponse.found)
+}
+
+// bytes records = 4;
+inline void TReplicateResponse::clear_records() {
+  _impl_.records_.ClearToEmpty();
+}
+inline const std::string& TReplicateResponse::records() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateResponse.records)
+  return _internal_records();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TReplicateResponse::set_records(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.records_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:NProto.TReplicateResponse.records)
+}
+inline std::string* TReplicateResponse::mutable_records() {
+  std::string* _s = _internal_mutable_records();
+  // @@protoc_insertion_point(field_mutable:NProto.TReplicateResponse.records)
+  return _s;
+}
+inline const std::string& TReplicateResponse::_internal_records() const {
+  return _impl_.records_.Get();
+}
+inline void TReplicateResponse::_internal_set_records(const std::string& value) {
+  
+  _impl_.records_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TReplicateResponse::_internal_mutable_records() {
+  
+  return _impl_.records_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TReplicateResponse::release_records() {
+  // @@protoc_insertion_point(field_release:NProto.TReplicateResponse.records)
+  return _impl_.records_.Release();
+}
+inline void TReplicateResponse::set_allocated_records(std::string* records) {
+  if (records != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.records_.SetAllocated(records, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.records_.IsDefault()) {
+    _impl_.records_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:NProto.TReplicateResponse.records)
+}
+
+// uint64 end_position = 5;
+inline void TReplicateResponse::clear_end_position() {
+  _impl_.end_position_ = uint64_t{0u};
+}
+inline uint64_t TReplicateResponse::_internal_end_position() const {
+  return _impl_.end_position_;
+}
+inline uint64_t TReplicateResponse::end_position() const {
+  // @@protoc_insertion_point(field_get:NProto.TReplicateResponse.end_position)
+  return _internal_end_position();
+}
+inline void TReplicateResponse::_internal_set_end_position(uint64_t value) {
+  
+  _impl_.end_position_ = value;
+}
+inline void TReplicateResponse::set_end_position(uint64_t value) {
+  _internal_set_end_position(value);
+  // @@protoc_insertion_point(field_set:NProto.TReplicateResponse.end_position)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace NProto
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::NProto::TScanResponse_EStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::NProto::TScanResponse_EStatus>() {
+  return ::NProto::TScanResponse_EStatus_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kv_2eproto
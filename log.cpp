@@ -1,7 +1,268 @@
 #include "log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
 namespace NLogging {
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr auto flush_interval = std::chrono::milliseconds(10);
+
+// Single-producer single-consumer byte ring owned by one logging thread.
+// The consumer is whoever holds Logger::flush_mutex.
+class Ring
+{
+public:
+    struct Header
+    {
+        uint32_t size;
+        const char* tag;
+        int64_t seconds;
+    };
+
+    static constexpr size_t capacity = 1 << 16;
+
+    // set when the owning thread exits, the ring is dropped once drained
+    std::atomic<bool> orphaned = false;
+
+private:
+    std::unique_ptr<char[]> data = std::make_unique<char[]>(capacity);
+    alignas(64) std::atomic<uint64_t> head = 0;
+    alignas(64) std::atomic<uint64_t> tail = 0;
+
+public:
+    // Producer side. False if there is no room for the record.
+    bool push(const char* tag, int64_t seconds, std::string_view message)
+    {
+        const Header header{static_cast<uint32_t>(message.size()), tag, seconds};
+        const auto t = tail.load(std::memory_order_relaxed);
+        if (capacity - (t - head.load(std::memory_order_acquire))
+                < sizeof(header) + message.size())
+        {
+            return false;
+        }
+
+        copy_in(t, &header, sizeof(header));
+        copy_in(t + sizeof(header), message.data(), message.size());
+        tail.store(t + sizeof(header) + message.size(), std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Calls f(header, message) for every queued record.
+    template <typename F>
+    void drain(F f, std::string* message)
+    {
+        auto h = head.load(std::memory_order_relaxed);
+        const auto t = tail.load(std::memory_order_acquire);
+        while (h != t) {
+            Header header;
+            copy_out(h, &header, sizeof(header));
+            message->resize(header.size);
+            copy_out(h + sizeof(header), &(*message)[0], header.size);
+            h += sizeof(header) + header.size;
+            f(header, *message);
+        }
+        head.store(h, std::memory_order_release);
+    }
+
+    bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+private:
+    void copy_in(uint64_t position, const void* src, size_t size)
+    {
+        const auto offset = position % capacity;
+        const auto first = std::min(size, capacity - offset);
+        memcpy(data.get() + offset, src, first);
+        memcpy(data.get(), static_cast<const char*>(src) + first, size - first);
+    }
+
+    void copy_out(uint64_t position, void* dst, size_t size) const
+    {
+        const auto offset = position % capacity;
+        const auto first = std::min(size, capacity - offset);
+        memcpy(dst, data.get() + offset, first);
+        memcpy(static_cast<char*>(dst) + first, data.get(), size - first);
+    }
+};
+
+using RingPtr = std::shared_ptr<Ring>;
+
+////////////////////////////////////////////////////////////////////////////////
+
+int64_t now_seconds()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Owns the per-thread rings and the thread writing them out to stderr.
+// Producers only touch their own ring and a cached timestamp, no locks and
+// no clock or localtime calls on the logging path.
+class Logger
+{
+private:
+    // refreshed by the flusher every flush_interval
+    std::atomic<int64_t> seconds = now_seconds();
+
+    std::mutex rings_mutex;
+    std::vector<RingPtr> rings;
+
+    std::mutex flush_mutex;
+    std::string output;
+    std::string message;
+    int64_t formatted_seconds = -1;
+    char formatted_time[32] = {};
+
+    std::mutex stop_mutex;
+    std::condition_variable stop_cv;
+    bool stopped = false;
+    std::thread flusher;
+
+public:
+    Logger()
+    {
+        flusher = std::thread([this] {
+            std::unique_lock<std::mutex> lock(stop_mutex);
+            while (!stop_cv.wait_for(lock, flush_interval, [this] { return stopped; })) {
+                seconds.store(now_seconds(), std::memory_order_relaxed);
+                flush();
+            }
+        });
+    }
+
+    ~Logger()
+    {
+        {
+            std::lock_guard<std::mutex> guard(stop_mutex);
+            stopped = true;
+        }
+        stop_cv.notify_one();
+        flusher.join();
+        flush();
+    }
+
+    RingPtr add_ring()
+    {
+        auto ring = std::make_shared<Ring>();
+        std::lock_guard<std::mutex> guard(rings_mutex);
+        rings.push_back(ring);
+        return ring;
+    }
+
+    void write(Ring& ring, EVerbosity level, const char* tag, std::string_view message)
+    {
+        if (message.size() > Ring::capacity - sizeof(Ring::Header)) {
+            message = message.substr(0, Ring::capacity - sizeof(Ring::Header));
+        }
+
+        const auto now = seconds.load(std::memory_order_relaxed);
+        while (!ring.push(tag, now, message)) {
+            // the flusher fell behind, drain on this thread instead
+            flush();
+        }
+
+        if (level <= EVerbosity::ERROR) {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> guard(flush_mutex);
+
+        std::vector<RingPtr> current;
+        {
+            std::lock_guard<std::mutex> guard(rings_mutex);
+            current = rings;
+        }
+
+        for (auto& ring: current) {
+            ring->drain([this] (const Ring::Header& header, const std::string& message) {
+                output += "[";
+                output += format_time(header.seconds);
+                output += " ";
+                output += header.tag;
+                output += "] ";
+                output += message;
+                output += "\n";
+            }, &message);
+        }
+
+        size_t written = 0;
+        while (written < output.size()) {
+            const auto n = ::write(STDERR_FILENO, output.data() + written, output.size() - written);
+            if (n <= 0) {
+                if (n == -1 && errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            written += n;
+        }
+        output.clear();
+
+        std::lock_guard<std::mutex> rings_guard(rings_mutex);
+        for (size_t i = 0; i < rings.size(); ) {
+            if (rings[i]->orphaned && rings[i]->empty()) {
+                rings[i] = std::move(rings.back());
+                rings.pop_back();
+            } else {
+                ++i;
+            }
+        }
+    }
+
+private:
+    // must be called with flush_mutex held
+    const char* format_time(int64_t s)
+    {
+        if (s != formatted_seconds) {
+            const auto tt = static_cast<time_t>(s);
+            struct tm tm;
+            localtime_r(&tt, &tm);
+            strftime(formatted_time, sizeof(formatted_time), "%Y-%m-%d %H:%M:%S", &tm);
+            formatted_seconds = s;
+        }
+
+        return formatted_time;
+    }
+};
+
+Logger& logger()
+{
+    static Logger instance;
+    return instance;
+}
+
+// Marks the thread's ring orphaned when the thread exits.
+struct ThreadRing
+{
+    RingPtr ring = logger().add_ring();
+
+    ~ThreadRing()
+    {
+        ring->orphaned = true;
+    }
+};
+
+}   // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 const LoggingEnv& logging_env()
@@ -10,4 +271,15 @@ const LoggingEnv& logging_env()
     return env;
 }
 
+void write_message(EVerbosity level, const char* tag, std::string_view message)
+{
+    thread_local ThreadRing thread_ring;
+    logger().write(*thread_ring.ring, level, tag, message);
+}
+
+void flush_messages()
+{
+    logger().flush();
+}
+
 }   // namespace NLogging
@@ -1,12 +1,11 @@
 #pragma once
 
 #include <cerrno>
-#include <chrono>
 #include <cstdlib>
-#include <iomanip>
-#include <iostream>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace NLogging {
 
@@ -44,15 +43,35 @@ const LoggingEnv& logging_env();
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Messages above this level are compiled out: the level checks below are
+// constant-folded and the message is never built. Release builds (NDEBUG)
+// keep up to INFO, pass -DLOG_MAX_VERBOSITY=4 to keep DEBUG as well.
+#ifndef LOG_MAX_VERBOSITY
+#ifdef NDEBUG
+#define LOG_MAX_VERBOSITY 3
+#else
+#define LOG_MAX_VERBOSITY 4
+#endif
+#endif
+
+constexpr EVerbosity max_verbosity = static_cast<EVerbosity>(LOG_MAX_VERBOSITY);
+
+// Queues the message for the background flusher thread. ERROR messages
+// are written out synchronously, together with everything queued before
+// them, since the caller is often about to abort().
+void write_message(EVerbosity level, const char* tag, std::string_view message);
+
+// Writes out everything queued so far.
+void flush_messages();
+
+////////////////////////////////////////////////////////////////////////////////
+
 #define LOG(level, tag, message)                                               \
 {                                                                              \
-    if (NLogging::level <= NLogging::logging_env().current_verbosity) {        \
-        const auto now = std::chrono::system_clock::now();                     \
-        const auto tt = std::chrono::system_clock::to_time_t(now);             \
-        static const auto format = "%Y-%m-%d %H:%M:%S";                        \
-                                                                               \
-        std::cerr << "[" << std::put_time(std::localtime(&tt), format)         \
-            << " " << tag << "] " << (message) << "\n";                        \
+    if (NLogging::level <= NLogging::max_verbosity                             \
+            && NLogging::level <= NLogging::logging_env().current_verbosity)   \
+    {                                                                          \
+        NLogging::write_message(NLogging::level, tag, (message));              \
     }                                                                          \
 }                                                                              \
 // LOG
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace NRpc {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Lock-free multi-producer single-consumer queue. Producers push with a
+// single CAS; the consumer takes everything at once with one exchange, so
+// there is no ABA problem and no node is ever touched by two threads at the
+// same time.
+template <typename T>
+class MpscQueue
+{
+private:
+    struct Node
+    {
+        T value;
+        Node* next = nullptr;
+    };
+
+    std::atomic<Node*> head = nullptr;
+
+public:
+    MpscQueue() = default;
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue()
+    {
+        drain([] (T&) {});
+    }
+
+    // Returns true if the queue was empty, i.e. the consumer may need a
+    // wakeup.
+    bool push(T value)
+    {
+        auto* node = new Node{std::move(value)};
+        node->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(
+                    node->next,
+                    node,
+                    std::memory_order_release,
+                    std::memory_order_relaxed))
+        {
+        }
+
+        return node->next == nullptr;
+    }
+
+    // Consumer only. Calls f for every queued value in push order, returns
+    // their count.
+    template <typename F>
+    size_t drain(F f)
+    {
+        auto* node = head.exchange(nullptr, std::memory_order_acquire);
+
+        Node* reversed = nullptr;
+        while (node) {
+            auto* next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        size_t count = 0;
+        while (reversed) {
+            auto* next = reversed->next;
+            f(reversed->value);
+            delete reversed;
+            reversed = next;
+            ++count;
+        }
+
+        return count;
+    }
+};
+
+}   // namespace NRpc
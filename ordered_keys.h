@@ -0,0 +1,98 @@
+#ifndef LOCAL_STORAGE_ORDERED_KEYS_H
+#define LOCAL_STORAGE_ORDERED_KEYS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// In-memory sorted set of keys for range scans: a two-level B+tree, that is
+// a sorted array of leaves holding up to 2 * leaf_size sorted keys each, and
+// the first key of every leaf next to each other for the binary search. A
+// scan walks consecutive keys of a leaf instead of chasing a pointer per key
+// like std::set. Any number of scans may run with one inserting thread.
+class OrderedKeys {
+public:
+    // Replaces the contents with sorted, unique keys.
+    void bulk_load(std::vector<std::string> keys) {
+        std::unique_lock<std::shared_mutex> g(mutex);
+        leaves.clear();
+        firsts.clear();
+        for (size_t i = 0; i < keys.size(); i += leaf_size) {
+            auto end = keys.begin() + std::min(keys.size(), i + leaf_size);
+            leaves.emplace_back(std::make_move_iterator(keys.begin() + i), std::make_move_iterator(end));
+            firsts.push_back(leaves.back().front());
+        }
+        count = keys.size();
+    }
+
+    void insert(const std::string &key) {
+        std::unique_lock<std::shared_mutex> g(mutex);
+        if (leaves.empty()) {
+            leaves.push_back({key});
+            firsts.push_back(key);
+            count = 1;
+            return;
+        }
+
+        size_t i = leaf_for(key);
+        auto &leaf = leaves[i];
+        auto it = std::lower_bound(leaf.begin(), leaf.end(), key);
+        if (it != leaf.end() && *it == key)
+            return;
+        leaf.insert(it, key);
+        if (i == 0 && key < firsts[0])
+            firsts[0] = key;
+        count++;
+
+        if (leaf.size() > 2 * leaf_size) {
+            std::vector<std::string> right(std::make_move_iterator(leaf.begin() + leaf_size),
+                                           std::make_move_iterator(leaf.end()));
+            leaf.resize(leaf_size);
+            firsts.insert(firsts.begin() + i + 1, right.front());
+            leaves.insert(leaves.begin() + i + 1, std::move(right));
+        }
+    }
+
+    // Appends to `keys` up to `limit` keys from [start, end) in order; an
+    // empty `end` is no bound.
+    void scan(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> *keys) const {
+        std::shared_lock<std::shared_mutex> g(mutex);
+        if (leaves.empty())
+            return;
+        size_t found = 0;
+        for (size_t i = leaf_for(start); i < leaves.size(); i++) {
+            const auto &leaf = leaves[i];
+            for (auto it = std::lower_bound(leaf.begin(), leaf.end(), start); it != leaf.end(); ++it) {
+                if (found == limit || (!end.empty() && *it >= end))
+                    return;
+                keys->push_back(*it);
+                found++;
+            }
+        }
+    }
+
+    size_t size() const {
+        std::shared_lock<std::shared_mutex> g(mutex);
+        return count;
+    }
+
+private:
+    static constexpr size_t leaf_size = 128;
+
+    std::vector<std::vector<std::string>> leaves;
+    std::vector<std::string> firsts;
+    size_t count = 0;
+    mutable std::shared_mutex mutex;
+
+    // The leaf `key` belongs to: the last one starting at or before it.
+    size_t leaf_for(const std::string &key) const {
+        auto it = std::upper_bound(firsts.begin(), firsts.end(), key);
+        return it == firsts.begin() ? 0 : it - firsts.begin() - 1;
+    }
+};
+
+#endif //LOCAL_STORAGE_ORDERED_KEYS_H
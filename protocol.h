@@ -5,6 +5,9 @@
 #include <cstring>
 #include <ostream>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace NProtocol {
 
@@ -18,63 +21,99 @@ constexpr char PUT_NUMBER_REQUEST = 5U;
 constexpr char PUT_NUMBER_RESPONSE = 6U;
 constexpr char GET_NUMBER_REQUEST = 7U;
 constexpr char GET_NUMBER_RESPONSE = 8U;
-
-struct Message
+constexpr char MULTI_PUT_REQUEST = 9U;
+constexpr char MULTI_PUT_RESPONSE = 10U;
+constexpr char MULTI_GET_REQUEST = 11U;
+constexpr char MULTI_GET_RESPONSE = 12U;
+constexpr char STATS_REQUEST = 13U;
+constexpr char STATS_RESPONSE = 14U;
+constexpr char SCAN_REQUEST = 15U;
+constexpr char SCAN_RESPONSE = 16U;
+constexpr char REPLICATE_REQUEST = 17U;
+constexpr char REPLICATE_RESPONSE = 18U;
+
+constexpr size_t HEADER_SIZE = 5;
+
+// Receive buffer that frames messages in place: recv() fills the free tail
+// directly, and complete messages are handed out as views into the buffer,
+// valid until the next call to tail().
+class MessageBuffer
 {
-    char message_type = 0;
-    uint32_t len = 0;
-    uint32_t len_bytes = 0;
-    std::string buffer;
+private:
+    std::vector<char> data;
+    size_t begin = 0;
+    size_t end = 0;
+
+public:
+    static constexpr size_t default_capacity = 64 * 1024;
+
+    explicit MessageBuffer(size_t capacity = default_capacity)
+        : data(capacity)
+    {
+    }
 
-    size_t to_read() const
+    // Free space to recv() into. Moves the unparsed bytes to the front when
+    // the tail runs short and grows the buffer for messages that don't fit.
+    std::pair<char*, size_t> tail()
     {
-        if (!message_type) {
-            return 1;
+        if (begin == end) {
+            begin = end = 0;
+        } else if (data.size() - end < data.size() / 4) {
+            memmove(data.data(), data.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
         }
 
-        if (len_bytes < 4) {
-            return 4 - len_bytes;
+        size_t needed = HEADER_SIZE;
+        if (end - begin >= HEADER_SIZE) {
+            needed += message_len();
         }
 
-        return len - buffer.size();
+        if (begin + needed > data.size()) {
+            memmove(data.data(), data.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+            if (needed > data.size()) {
+                data.resize(needed);
+            }
+        }
+
+        return {data.data() + end, data.size() - end};
     }
 
-    void on_data(char* buf, size_t size)
+    void commit(size_t count)
     {
-        if (!message_type) {
-            VERIFY(size == 1, "unexpected message_type size");
-
-            message_type = buf[0];
-        } else if (len_bytes < 4) {
-            VERIFY(size <= 4 - len_bytes, "unexpected len size");
+        VERIFY(end + count <= data.size(), "unexpected recv size");
 
-            // XXX not portable
-            memcpy(reinterpret_cast<char*>(&len) + len_bytes, buf, size);
-            len_bytes += size;
+        end += count;
+    }
 
-            if (len_bytes == 4) {
-                buffer.reserve(len);
-            }
-        } else {
-            VERIFY(size <= len - buffer.size(), "unexpected len size");
+    // Returns the next complete message if there is one.
+    bool next(char* message_type, std::string_view* message)
+    {
+        if (end - begin < HEADER_SIZE) {
+            return false;
+        }
 
-            auto old_size = buffer.size();
-            buffer.resize(old_size + size);
-            memcpy(const_cast<char*>(buffer.data()) + old_size, buf, size);
+        const auto len = message_len();
+        if (end - begin < HEADER_SIZE + len) {
+            return false;
         }
-    }
 
-    bool is_complete() const
-    {
-        return len_bytes == 4 && to_read() == 0;
+        *message_type = data[begin];
+        *message = std::string_view(data.data() + begin + HEADER_SIZE, len);
+        begin += HEADER_SIZE + len;
+
+        return true;
     }
 
-    void reset()
+private:
+    uint32_t message_len() const
     {
-        message_type = 0;
-        len_bytes = 0;
-        len = 0;
-        buffer.clear();
+        uint32_t len;
+        // XXX not portable
+        memcpy(&len, data.data() + begin + 1, sizeof(len));
+        return len;
     }
 };
 
@@ -86,4 +125,25 @@ inline void serialize_header(char message_type, uint32_t len, std::ostream& out)
     out.write(reinterpret_cast<const char*>(&len), 4);
 }
 
+// Writes the header into the first HEADER_SIZE bytes of `out`, returns the
+// position of the message body.
+inline char* serialize_header(char message_type, uint32_t len, char* out)
+{
+    out[0] = message_type;
+    // XXX not portable
+    memcpy(out + 1, &len, sizeof(len));
+    return out + HEADER_SIZE;
+}
+
+// Frames a protobuf message into `out` with a single SerializeToArray,
+// reusing whatever capacity `out` already has.
+template <typename TMessage>
+void serialize(char message_type, const TMessage& message, std::string* out)
+{
+    const auto len = message.ByteSizeLong();
+    out->resize(HEADER_SIZE + len);
+    auto* body = serialize_header(message_type, len, out->data());
+    message.SerializeToArray(body, len);
+}
+
 }   // namespace NProtocol
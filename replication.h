@@ -0,0 +1,321 @@
+#pragma once
+
+#include "log.h"
+#include "protocol.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace NRpc {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// The primary's replication stream: the records of synced puts of all shards,
+// the bytes the storage appended to its segments, in the order they were
+// synced. A position is a byte offset into the stream, which starts anew with
+// a random stream_id every time the server does.
+//
+// Only the last `capacity` bytes are kept, as the batches they were appended
+// in: a follower asks for the bytes from where it has applied up to, and one
+// that is further behind or follows an older stream copies the storage instead.
+class ReplicationLog
+{
+private:
+    struct Batch
+    {
+        uint64_t position = 0;
+        std::string records;
+    };
+
+    const size_t capacity;
+    const uint64_t id;
+
+    mutable std::mutex mutex;
+    std::deque<Batch> batches;
+    size_t buffered = 0;
+    uint64_t end = 0;
+
+public:
+    explicit ReplicationLog(size_t capacity)
+        : capacity(capacity)
+        , id(random_id())
+    {
+    }
+
+    uint64_t stream_id() const
+    {
+        return id;
+    }
+
+    void append(std::string records)
+    {
+        if (records.empty()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex);
+        buffered += records.size();
+        batches.push_back({end, std::move(records)});
+        end += batches.back().records.size();
+        // the newest batch stays even if it alone is over capacity
+        while (buffered > capacity && batches.size() > 1) {
+            buffered -= batches.front().records.size();
+            batches.pop_front();
+        }
+    }
+
+    // Appends to `records` the batches from `position` of stream `stream_id`
+    // on: the first one whole, the next ones while they fit in max_bytes.
+    // False unless `position` starts a buffered batch or is the end of the
+    // stream.
+    bool read(
+        uint64_t stream_id,
+        uint64_t position,
+        size_t max_bytes,
+        std::string* records) const
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (stream_id != id) {
+            return false;
+        }
+
+        if (position == end) {
+            return true;
+        }
+
+        auto it = std::lower_bound(batches.begin(), batches.end(), position,
+            [] (const Batch& batch, uint64_t position) {
+                return batch.position < position;
+            });
+        if (it == batches.end() || it->position != position) {
+            return false;
+        }
+
+        for (; it != batches.end(); ++it) {
+            if (!records->empty() && records->size() + it->records.size() > max_bytes) {
+                break;
+            }
+            records->append(it->records);
+        }
+
+        return true;
+    }
+
+    uint64_t end_position() const
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        return end;
+    }
+
+    size_t buffered_bytes() const
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        return buffered;
+    }
+
+private:
+    // nonzero: a follower that never replicated asks for stream 0
+    static uint64_t random_id()
+    {
+        std::random_device device;
+        uint64_t id = 0;
+        while (id == 0) {
+            id = (static_cast<uint64_t>(device()) << 32) | device();
+        }
+        return id;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Where a follower is in its primary's stream; kept in a file so that a
+// restarted follower picks up where it left off. Saved after the records up
+// to `position` are synced: a stale file only makes the follower apply some
+// records again, which changes nothing.
+struct ReplicaState
+{
+    uint64_t stream_id = 0;
+    uint64_t position = 0;
+
+    void load(const std::string& filename)
+    {
+        std::ifstream f(filename);
+        if (!(f >> stream_id >> position)) {
+            stream_id = position = 0;
+        }
+    }
+
+    void save(const std::string& filename) const
+    {
+        const auto tmp_filename = filename + ".tmp";
+        {
+            std::ofstream f(tmp_filename, std::ios::trunc);
+            f << stream_id << " " << position << "\n";
+            if (!f) {
+                LOG_ERROR_S("failed to write " << tmp_filename);
+                return;
+            }
+        }
+
+        if (rename(tmp_filename.c_str(), filename.c_str()) == -1) {
+            LOG_PERROR("rename failed");
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// A follower's connection to its primary over the protocol clients use:
+// blocking, one exchange at a time, and given up on after `timeout` without
+// progress.
+class PrimaryConnection
+{
+private:
+    int fd = -1;
+    NProtocol::MessageBuffer input;
+    std::string output;
+
+public:
+    PrimaryConnection() = default;
+
+    PrimaryConnection(const PrimaryConnection&) = delete;
+    PrimaryConnection& operator=(const PrimaryConnection&) = delete;
+
+    ~PrimaryConnection()
+    {
+        close();
+    }
+
+    bool connected() const
+    {
+        return fd != -1;
+    }
+
+    // `address` is host:port.
+    bool connect(const std::string& address, std::chrono::milliseconds timeout)
+    {
+        close();
+
+        const auto colon = address.rfind(':');
+        if (colon == std::string::npos) {
+            LOG_ERROR_S("bad primary address " << address);
+            return false;
+        }
+
+        struct addrinfo hints = {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        struct addrinfo* result;
+        const auto host = address.substr(0, colon);
+        const auto port = address.substr(colon + 1);
+        if (getaddrinfo(host.c_str(), port.c_str(), &hints, &result) != 0) {
+            LOG_ERROR_S("getaddrinfo failed for " << address);
+            return false;
+        }
+
+        for (auto* rp = result; rp != nullptr && fd == -1; rp = rp->ai_next) {
+            fd = socket(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
+            if (fd != -1 && ::connect(fd, rp->ai_addr, rp->ai_addrlen) == -1) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+        freeaddrinfo(result);
+
+        if (fd == -1) {
+            LOG_PERROR("failed to connect to the primary");
+            return false;
+        }
+
+        struct timeval tv;
+        tv.tv_sec = timeout.count() / 1000;
+        tv.tv_usec = timeout.count() % 1000 * 1000;
+        int nodelay = 1;
+        if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) == -1
+                || setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) == -1
+                || setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay)) == -1)
+        {
+            LOG_PERROR("setsockopt failed");
+        }
+
+        input = NProtocol::MessageBuffer();
+        return true;
+    }
+
+    void close()
+    {
+        if (fd != -1) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    template <typename TMessage>
+    bool send(char message_type, const TMessage& message)
+    {
+        NProtocol::serialize(message_type, message, &output);
+        for (size_t sent = 0; sent < output.size();) {
+            const auto res = ::send(fd, output.data() + sent, output.size() - sent, MSG_NOSIGNAL);
+            if (res == -1 && errno == EINTR) {
+                continue;
+            }
+            if (res <= 0) {
+                LOG_PERROR("send to the primary failed");
+                return false;
+            }
+            sent += res;
+        }
+        return true;
+    }
+
+    // Waits for the next message, which must be of `message_type`.
+    template <typename TMessage>
+    bool receive(char message_type, TMessage* message)
+    {
+        char type;
+        std::string_view body;
+        while (!input.next(&type, &body)) {
+            auto [buf, len] = input.tail();
+            const auto res = recv(fd, buf, len, 0);
+            if (res == -1 && errno == EINTR) {
+                continue;
+            }
+            if (res <= 0) {
+                if (res == 0) {
+                    LOG_ERROR("the primary closed the connection");
+                } else {
+                    LOG_PERROR("recv from the primary failed");
+                }
+                return false;
+            }
+            input.commit(res);
+        }
+
+        if (type != message_type || !message->ParseFromArray(body.data(), body.size())) {
+            LOG_ERROR_S("unexpected message of type " << static_cast<int>(type) << " from the primary");
+            return false;
+        }
+        return true;
+    }
+};
+
+}   // namespace NRpc
@@ -3,48 +3,175 @@
 #include "log.h"
 #include "protocol.h"
 
+#include <array>
 #include <deque>
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 namespace NRpc {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Per-connection bounds on the work a client may pile up: once a connection
+// reaches either limit its input is left unread until the output drains to
+// half of both. 0 means unlimited.
+struct FlowLimits
+{
+    // queued responses plus the ones owed by the committer
+    size_t max_outstanding = 0;
+    // bytes of queued responses
+    size_t max_output_bytes = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 struct SocketState
 {
     int fd = 0;
 
-    NProtocol::Message current_message;
+    NProtocol::MessageBuffer input;
 
     std::deque<std::string> output_queue;
 
-    uint32_t current_output_sent_count = 0;
-    std::string current_output;
+    // total size of output_queue
+    size_t output_bytes = 0;
+
+    // responses that someone else (the committer) will queue later
+    size_t deferred_responses = 0;
+
+    // reading stopped at the limits, set by process_messages() and
+    // process_input(); the event loop resumes the connection once drained
+    bool paused = false;
+
+    // bytes of output_queue.front() that are already sent
+    size_t current_output_sent_count = 0;
+
+    // sent output buffers, kept to serialize new responses into
+    std::vector<std::string> free_buffers;
+
+    static constexpr size_t max_free_buffers = 64;
+    static constexpr size_t max_free_buffer_capacity = 64 * 1024;
+
+    std::string acquire_buffer()
+    {
+        if (free_buffers.empty()) {
+            return {};
+        }
+
+        auto buffer = std::move(free_buffers.back());
+        free_buffers.pop_back();
+        buffer.clear();
+        return buffer;
+    }
+
+    void queue_output(std::string buffer)
+    {
+        output_bytes += buffer.size();
+        output_queue.push_back(std::move(buffer));
+    }
+
+    size_t outstanding() const
+    {
+        return output_queue.size() + deferred_responses;
+    }
+
+    bool over(const FlowLimits& limits) const
+    {
+        return (limits.max_outstanding && outstanding() >= limits.max_outstanding)
+            || (limits.max_output_bytes && output_bytes >= limits.max_output_bytes);
+    }
+
+    // Whether a paused connection may resume: waits for half the limits so
+    // that it doesn't flap on every send.
+    bool drained(const FlowLimits& limits) const
+    {
+        return (!limits.max_outstanding || outstanding() <= limits.max_outstanding / 2)
+            && (!limits.max_output_bytes || output_bytes <= limits.max_output_bytes / 2);
+    }
+
+    void release_buffer(std::string buffer)
+    {
+        if (free_buffers.size() < max_free_buffers
+                && buffer.capacity() <= max_free_buffer_capacity)
+        {
+            free_buffers.push_back(std::move(buffer));
+        }
+    }
 };
 
 using SocketStatePtr = std::shared_ptr<SocketState>;
 
 ////////////////////////////////////////////////////////////////////////////////
 
-// input -> output func
-using Handler =
-    std::function<std::string(int fd, char message_type, const std::string& message)>;
+// input -> output func: the response is serialized into `response`, which is
+// an empty pooled buffer, and left empty if there is nothing to send now.
+// The message is only valid during the call.
+using Handler = std::function<void(
+    int fd,
+    char message_type,
+    std::string_view message,
+    std::string* response)>;
 
 ////////////////////////////////////////////////////////////////////////////////
 
-inline bool process_input(SocketState& state, const Handler& handler)
+// Hands every complete message in the input buffer to the handler and queues
+// the responses, stopping early once the connection is over its limits.
+inline void process_messages(
+    SocketState& state,
+    const Handler& handler,
+    const FlowLimits& limits = {})
+{
+    char message_type;
+    std::string_view message;
+    while (true) {
+        if (state.over(limits)) {
+            state.paused = true;
+            break;
+        }
+
+        if (!state.input.next(&message_type, &message)) {
+            break;
+        }
+
+        auto response = state.acquire_buffer();
+        handler(state.fd, message_type, message, &response);
+
+        if (!response.empty()) {
+            state.queue_output(std::move(response));
+        } else {
+            state.release_buffer(std::move(response));
+        }
+    }
+}
+
+// Reads and handles messages until the socket runs dry or the connection
+// goes over its limits; in the latter case the rest stays in the socket
+// buffer, which pushes back on the client through TCP flow control.
+inline bool process_input(
+    SocketState& state,
+    const Handler& handler,
+    const FlowLimits& limits = {})
 {
+    // messages left over from when the connection went over its limits
+    process_messages(state, handler, limits);
+
     bool success = true;
 
-    char buf[512];
     int total_read = 0;
     while (true) {
-        auto len = std::min(sizeof(buf), state.current_message.to_read());
+        if (state.over(limits)) {
+            state.paused = true;
+            return true;
+        }
+
+        auto [buf, len] = state.input.tail();
         auto count = recv(state.fd, buf, len, 0);
 
         if (count == -1) {
@@ -61,23 +188,12 @@ inline bool process_input(SocketState& state, const Handler& handler)
 
         total_read += count;
 
-        state.current_message.on_data(buf, count);
+        state.input.commit(count);
+        process_messages(state, handler, limits);
 
-        if (count < len) {
+        if (static_cast<size_t>(count) < len) {
             break;
         }
-
-        if (state.current_message.is_complete()) {
-            auto response = handler(state.fd,
-                state.current_message.message_type,
-                state.current_message.buffer);
-
-            state.current_message.reset();
-
-            if (!response.empty()) {
-                state.output_queue.push_back(std::move(response));
-            }
-        }
     }
 
     if (total_read == 0) {
@@ -90,31 +206,63 @@ inline bool process_input(SocketState& state, const Handler& handler)
 
 ////////////////////////////////////////////////////////////////////////////////
 
-inline bool process_output(SocketState& state)
+// max number of queued responses flushed by a single sendmsg
+constexpr size_t max_output_iovecs = 64;
+
+// Points iov at the queued output, starting where the previous send stopped.
+// Returns the number of iovecs used and their total length in `len`.
+inline size_t prepare_output(
+    SocketState& state,
+    std::array<struct iovec, max_output_iovecs>& iov,
+    size_t* len)
 {
-    bool success = true;
+    size_t iovcnt = 0;
+    *len = 0;
+    for (auto& buffer: state.output_queue) {
+        if (iovcnt == iov.size()) {
+            break;
+        }
 
-    while (true) {
-        auto& buffer = state.current_output;
-        auto& offset = state.current_output_sent_count;
+        const auto skip = iovcnt ? 0 : state.current_output_sent_count;
+        iov[iovcnt].iov_base = buffer.data() + skip;
+        iov[iovcnt].iov_len = buffer.size() - skip;
+        *len += iov[iovcnt].iov_len;
+        ++iovcnt;
+    }
 
-        if (state.current_output.empty()) {
-            if (state.output_queue.empty()) {
-                break;
-            }
+    return iovcnt;
+}
 
-            buffer = state.output_queue.front();
-            offset = 0;
-            state.output_queue.pop_front();
-        }
+// Drops fully sent buffers and remembers how far into the next one `count`
+// more sent bytes got.
+inline void commit_output(SocketState& state, size_t count)
+{
+    size_t sent = count + state.current_output_sent_count;
+    while (!state.output_queue.empty()
+            && sent >= state.output_queue.front().size())
+    {
+        sent -= state.output_queue.front().size();
+        state.output_bytes -= state.output_queue.front().size();
+        state.release_buffer(std::move(state.output_queue.front()));
+        state.output_queue.pop_front();
+    }
+    state.current_output_sent_count = sent;
+}
 
-        auto len = buffer.size() - offset;
+inline bool process_output(SocketState& state)
+{
+    bool success = true;
+
+    std::array<struct iovec, max_output_iovecs> iov;
+    while (!state.output_queue.empty()) {
+        size_t len = 0;
+        const auto iovcnt = prepare_output(state, iov, &len);
 
-        const auto count = send(
-            state.fd,
-            buffer.data() + offset,
-            len,
-            MSG_NOSIGNAL);
+        struct msghdr msg = {};
+        msg.msg_iov = iov.data();
+        msg.msg_iovlen = iovcnt;
+
+        const auto count = sendmsg(state.fd, &msg, MSG_NOSIGNAL);
 
         if (count == -1) {
             if (errno != EAGAIN) {
@@ -128,10 +276,10 @@ inline bool process_output(SocketState& state)
             break;
         }
 
-        if (count == len) {
-            buffer.clear();
-        } else {
-            offset += count;
+        commit_output(state, count);
+
+        if (static_cast<size_t>(count) < len) {
+            break;
         }
     }
 
@@ -1,16 +1,24 @@
+#include "completion.h"
+#include "group_commit.h"
+#include "histogram.h"
 #include "kv.pb.h"
 #include "log.h"
 #include "protocol.h"
+#include "replication.h"
 #include "rpc.h"
 #include "storage.h"
+#include "uring.h"
+#include "worker_pool.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
 #include <cstring>
 #include <cerrno>
-#include <sstream>
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <errno.h>
 #include <fcntl.h>
@@ -18,11 +26,13 @@
 #include <unistd.h>
 
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <queue>
 #include <thread>
 #include <csignal>
+#include <vector>
 
 static_assert(EAGAIN == EWOULDBLOCK);
 
@@ -35,11 +45,207 @@ namespace {
 ////////////////////////////////////////////////////////////////////////////////
 
 constexpr int max_events = 32;
+constexpr int loop_poll_timeout_ms = 100;
+constexpr unsigned uring_entries = 1024;
+constexpr auto commit_poll_timeout = std::chrono::milliseconds(100);
+constexpr auto compaction_poll_timeout = std::chrono::milliseconds(100);
+constexpr uint64_t compaction_step_bytes = 1024 * 1024;
+// keys per SCAN request, it returns next_key to continue from
+constexpr size_t max_scan_keys = 10000;
+// a SCAN response is split into chunks of about this size
+constexpr size_t scan_chunk_bytes = 64 * 1024;
+// the replication stream is fetched in batches of about this size
+constexpr size_t replication_batch_bytes = 1024 * 1024;
+// a follower gives up on a primary that doesn't answer for this long...
+constexpr auto replication_timeout = std::chrono::seconds(10);
+// ...and retries this much later
+constexpr auto replication_retry_timeout = std::chrono::seconds(1);
+// where a follower is in the stream of its primary
+const std::string replica_state_filename = "replica";
 volatile std::sig_atomic_t running = 1;
 
 ////////////////////////////////////////////////////////////////////////////////
 
-auto create_and_bind(std::string const& port)
+struct ServerEnv
+{
+    // event loops, each with its own SO_REUSEPORT listening socket
+    size_t loop_threads = 1;
+    // storage shards; must not change between restarts
+    size_t storage_shards = 1;
+    // the committer syncs as soon as this many PUT acks are pending...
+    size_t commit_batch_size = 256;
+    // ...or as soon as the oldest of them has waited this long
+    std::chrono::microseconds commit_latency{1000};
+    // segments with at least this share of dead bytes are compacted...
+    uint64_t compaction_min_dead_percent = 50;
+    // ...copying at most this many bytes per second
+    uint64_t compaction_rate = 16 * 1024 * 1024;
+    // indexes are checkpointed once their journal grows past this size
+    uint64_t checkpoint_journal_size = 64 * 1024 * 1024;
+    // value cache budget, split evenly between the storage shards; off by
+    // default, see Storage::read_value()
+    uint64_t cache_size = 0;
+    // keep the keys sorted in memory for SCAN
+    bool ordered_index = true;
+    // compress values of at least compression_min_size bytes
+    bool compression = false;
+    uint64_t compression_min_size = 64;
+    // value log segment size; must not change between restarts
+    uint64_t segment_size = 64 * 1024 * 1024;
+    // fallocate() new segments
+    bool preallocate_segments = true;
+    // append to segments with O_DIRECT
+    bool direct_io = false;
+    // per-connection backpressure, see FlowLimits
+    size_t max_outstanding_responses = 1024;
+    size_t max_output_bytes = 4 * 1024 * 1024;
+    // GETs that would block on the disk are read by this many threads...
+    size_t disk_threads = 4;
+    // ...unless this many are already queued: then they are read inline
+    size_t max_queued_reads = 1024;
+    // primary: the replication stream kept for followers, 0 disables it
+    size_t replication_buffer_size = 0;
+    // follower: host:port of the primary to replicate
+    std::string replicate_from;
+    // follower: how often to ask a primary it caught up with for more
+    std::chrono::milliseconds replication_poll{10};
+
+    // serve sockets through io_uring instead of epoll
+    bool use_io_uring = false;
+
+    ServerEnv()
+    {
+        if (auto value = std::getenv("IO_ENGINE")) {
+            if (std::string(value) == "io_uring") {
+                use_io_uring = true;
+            } else if (std::string(value) != "epoll") {
+                abort();
+            }
+        }
+
+        if (auto value = std::getenv("LOOP_THREADS")) {
+            loop_threads = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("STORAGE_SHARDS")) {
+            storage_shards = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("COMMIT_BATCH_SIZE")) {
+            commit_batch_size = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("COMMIT_LATENCY_US")) {
+            commit_latency = std::chrono::microseconds(std::max(0, atoi(value)));
+        }
+
+        if (auto value = std::getenv("COMPACTION_MIN_DEAD_PERCENT")) {
+            compaction_min_dead_percent = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("COMPACTION_RATE_KB")) {
+            compaction_rate = std::max(1, atoi(value)) * 1024ULL;
+        }
+
+        if (auto value = std::getenv("CHECKPOINT_JOURNAL_MB")) {
+            checkpoint_journal_size = std::max(1, atoi(value)) * 1024ULL * 1024;
+        }
+
+        if (auto value = std::getenv("CACHE_SIZE_MB")) {
+            cache_size = std::max(0, atoi(value)) * 1024ULL * 1024;
+        }
+
+        if (auto value = std::getenv("ORDERED_INDEX")) {
+            ordered_index = atoi(value) != 0;
+        }
+
+        if (auto value = std::getenv("COMPRESSION")) {
+            compression = atoi(value) != 0;
+        }
+
+        if (auto value = std::getenv("COMPRESSION_MIN_BYTES")) {
+            compression_min_size = std::max(0, atoi(value));
+        }
+
+        if (auto value = std::getenv("SEGMENT_SIZE_KB")) {
+            segment_size = std::max(1, atoi(value)) * 1024ULL;
+        }
+
+        if (auto value = std::getenv("SEGMENT_PREALLOCATE")) {
+            preallocate_segments = atoi(value) != 0;
+        }
+
+        if (auto value = std::getenv("DIRECT_IO")) {
+            direct_io = atoi(value) != 0;
+        }
+
+        if (auto value = std::getenv("MAX_OUTSTANDING_RESPONSES")) {
+            max_outstanding_responses = std::max(0, atoi(value));
+        }
+
+        if (auto value = std::getenv("MAX_OUTPUT_KB")) {
+            max_output_bytes = std::max(0, atoi(value)) * 1024ULL;
+        }
+
+        if (auto value = std::getenv("DISK_THREADS")) {
+            disk_threads = std::max(0, atoi(value));
+        }
+
+        if (auto value = std::getenv("DISK_QUEUE_SIZE")) {
+            max_queued_reads = std::max(1, atoi(value));
+        }
+
+        if (auto value = std::getenv("REPLICATION_BUFFER_MB")) {
+            replication_buffer_size = std::max(0, atoi(value)) * 1024ULL * 1024;
+        }
+
+        if (auto value = std::getenv("REPLICATE_FROM")) {
+            replicate_from = value;
+        }
+
+        if (auto value = std::getenv("REPLICATION_POLL_MS")) {
+            replication_poll = std::chrono::milliseconds(std::max(1, atoi(value)));
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Request and response messages reused by every request an event loop thread
+// handles: Parse/Clear keep the capacity of their string fields, so steady
+// state traffic doesn't allocate keys and values.
+struct Messages
+{
+    NProto::TGetNumberRequest get_number_request;
+    NProto::TGetNumberResponse get_number_response;
+    NProto::TPutNumberRequest put_number_request;
+    NProto::TPutNumberResponse put_number_response;
+    NProto::TGetRequest get_request;
+    NProto::TGetResponse get_response;
+    NProto::TPutRequest put_request;
+    NProto::TPutResponse put_response;
+    NProto::TMultiGetRequest multi_get_request;
+    NProto::TMultiGetResponse multi_get_response;
+    NProto::TMultiPutRequest multi_put_request;
+    NProto::TMultiPutResponse multi_put_response;
+    NProto::TScanRequest scan_request;
+    NProto::TScanResponse scan_response;
+    NProto::TReplicateRequest replicate_request;
+    NProto::TReplicateResponse replicate_response;
+
+    // per-shard slices of multi requests
+    std::vector<std::vector<const std::string*>> shard_keys;
+    std::vector<std::vector<std::string*>> shard_values;
+    std::vector<std::vector<Storage::KeyValue>> shard_kvs;
+};
+
+thread_local Messages messages;
+
+////////////////////////////////////////////////////////////////////////////////
+
+// With `reuse_port` every event loop binds its own socket to the same port;
+// a single loop doesn't, so that a second server on the port fails to bind.
+auto create_and_bind(std::string const& port, bool reuse_port)
 {
     struct addrinfo hints;
 
@@ -63,6 +269,13 @@ auto create_and_bind(std::string const& port)
             continue;
         }
 
+        int reuse = 1;
+        if (reuse_port
+                && setsockopt(socketfd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) == -1)
+        {
+            LOG_PERROR("setsockopt(SO_REUSEPORT) failed");
+        }
+
         sockt = bind(socketfd, rp->ai_addr, rp->ai_addrlen);
         if (sockt == 0) {
             break;
@@ -135,7 +348,7 @@ SocketStatePtr accept_connection(
 
     if (ret == 0) {
         LOG_INFO_S("accepted connection on fd " << infd
-            << "(host=" << hbuf << ", port=" << sbuf << ")");
+            << "(host=" << hbuf.c_str() << ", port=" << sbuf.c_str() << ")");
     }
 
     if (!make_socket_nonblocking(infd)) {
@@ -155,69 +368,287 @@ SocketStatePtr accept_connection(
     return state;
 }
 
+////////////////////////////////////////////////////////////////////////////////
 
-}   // namespace
+// Counters of one event loop. Only its thread records into them, under
+// `mutex`, which is contended only while a STATS request copies them out.
+struct LoopMetrics
+{
+    // indexed by request message type
+    static constexpr size_t max_types = 32;
+
+    std::mutex mutex;
+    std::array<uint64_t, max_types> requests = {};
+    std::array<NMetrics::Histogram, max_types> handler_latency_ns;
+    uint64_t connections = 0;
+    // connections paused by their flow limits
+    uint64_t pauses = 0;
+    // GETs handed to the disk threads
+    uint64_t cold_reads = 0;
+};
+
+// Recorded by the committer thread.
+struct CommitMetrics
+{
+    std::mutex mutex;
+    NMetrics::Histogram batch_size;
+    // syncing both storages, fsyncs included
+    NMetrics::Histogram sync_us;
+    // from the put to its ack being queued for sending
+    NMetrics::Histogram ack_latency_us;
+};
+
+// Recorded by a follower's replication thread.
+struct ReplicationMetrics
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::mutex mutex;
+    bool connected = false;
+    // applied (and synced) up to here...
+    uint64_t position = 0;
+    // ...of a stream that was this long at the last fetch
+    uint64_t primary_position = 0;
+    uint64_t applied_bytes = 0;
+    // storage copies, on the first start and whenever the stream was lost
+    uint64_t resyncs = 0;
+    // the lag is how long ago the follower last had all of the stream
+    Clock::time_point caught_up = Clock::now();
+};
+
+const char* request_name(size_t type)
+{
+    switch (type) {
+        case PUT_REQUEST: return "put";
+        case GET_REQUEST: return "get";
+        case PUT_NUMBER_REQUEST: return "put2";
+        case GET_NUMBER_REQUEST: return "get2";
+        case MULTI_PUT_REQUEST: return "mput";
+        case MULTI_GET_REQUEST: return "mget";
+        case STATS_REQUEST: return "stats";
+        case SCAN_REQUEST: return "scan";
+        case REPLICATE_REQUEST: return "replicate";
+    }
+    return nullptr;
+}
 
-////////////////////////////////////////////////////////////////////////////////
+void add_histogram(
+    const std::string& name,
+    const NMetrics::Histogram& histogram,
+    NProto::TStatsResponse* response)
+{
+    auto* h = response->add_histograms();
+    h->set_name(name);
+    h->set_count(histogram.count());
+    h->set_mean(histogram.mean());
+    h->set_p50(histogram.percentile(0.5));
+    h->set_p99(histogram.percentile(0.99));
+    h->set_p999(histogram.percentile(0.999));
+    h->set_max(histogram.max());
+}
 
-void signal_handler(int) {
-    running = 0;
+void add_counter(const std::string& name, uint64_t value, NProto::TStatsResponse* response)
+{
+    auto* c = response->add_counters();
+    c->set_name(name);
+    c->set_value(value);
 }
 
-int main(int argc, const char** argv)
+////////////////////////////////////////////////////////////////////////////////
+
+struct EventLoop
 {
-    if (argc < 2) {
-        return 1;
+    size_t id = 0;
+    int socketfd = -1;
+    int epollfd = -1;
+
+    // connections and their state are touched by the loop thread alone
+    std::unordered_map<int, SocketStatePtr> states;
+
+    // epoll engine: paused fds registered without EPOLLIN
+    std::unordered_set<int> unarmed;
+
+    // responses completed by other threads
+    std::unique_ptr<CompletionQueue> completions;
+
+    std::unique_ptr<Uring> ring;
+
+    LoopMetrics metrics;
+
+    void update_connections()
+    {
+        std::lock_guard<std::mutex> guard(metrics.mutex);
+        metrics.connections = states.size();
     }
+};
 
-    /*
-     * socket creation and epoll boilerplate
-     * TODO extract into struct Bootstrap
-     */
+// epoll engine: drops EPOLLIN from a paused connection that is still over
+// its limits and resumes it once drained.
+void update_flow(EventLoop& loop, SocketState& state, const FlowLimits& limits)
+{
+    struct epoll_event event;
+    event.data.fd = state.fd;
+
+    if (state.paused && state.drained(limits)) {
+        state.paused = false;
+        loop.unarmed.erase(state.fd);
+        // re-arming an edge-triggered fd reports its current readiness, so
+        // the loop hears about the connection even if no new data arrives
+        // and handles what it read before the pause
+        event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+    } else if (state.paused && loop.unarmed.insert(state.fd).second) {
+        std::lock_guard<std::mutex> guard(loop.metrics.mutex);
+        ++loop.metrics.pauses;
+        event.events = EPOLLOUT | EPOLLET;
+    } else {
+        return;
+    }
 
-    signal(SIGINT, signal_handler);
+    if (epoll_ctl(loop.epollfd, EPOLL_CTL_MOD, state.fd, &event) == -1) {
+        LOG_PERROR("epoll_ctl failed");
+    }
+}
 
-    auto socketfd = ::create_and_bind(argv[1]);
-    if (socketfd == -1) {
-        return 1;
+bool bootstrap(EventLoop& loop, const std::string& port, bool reuse_port, bool use_io_uring)
+{
+    loop.socketfd = ::create_and_bind(port, reuse_port);
+    if (loop.socketfd == -1) {
+        return false;
     }
 
-    if (!::make_socket_nonblocking(socketfd)) {
-        return 1;
+    if (!::make_socket_nonblocking(loop.socketfd)) {
+        return false;
     }
 
-    if (listen(socketfd, SOMAXCONN) == -1) {
+    if (listen(loop.socketfd, SOMAXCONN) == -1) {
         LOG_ERROR("listen failed");
-        return 1;
+        return false;
     }
 
-    int epollfd = epoll_create1(0);
-    if (epollfd == -1) {
+    loop.epollfd = epoll_create1(0);
+    if (loop.epollfd == -1) {
         LOG_ERROR("epoll_create1 failed");
-        return 1;
+        return false;
     }
 
     struct epoll_event event;
-    event.data.fd = socketfd;
+    event.data.fd = loop.socketfd;
     event.events = EPOLLIN | EPOLLET;
-    if (epoll_ctl(epollfd, EPOLL_CTL_ADD, socketfd, &event) == -1) {
+    if (epoll_ctl(loop.epollfd, EPOLL_CTL_ADD, loop.socketfd, &event) == -1) {
         LOG_ERROR("epoll_ctl failed");
+        return false;
+    }
+
+    if (use_io_uring) {
+        loop.ring = std::make_unique<Uring>();
+        if (!loop.ring->init(::uring_entries)) {
+            LOG_ERROR("io_uring unavailable, falling back to epoll");
+            loop.ring.reset();
+        }
+    }
+
+    // io_uring reads the eventfd with a blocking IORING_OP_READ
+    loop.completions = std::make_unique<CompletionQueue>(loop.ring != nullptr);
+    if (!loop.ring) {
+        event.data.fd = loop.completions->fd();
+        event.events = EPOLLIN | EPOLLET;
+        if (epoll_ctl(loop.epollfd, EPOLL_CTL_ADD, loop.completions->fd(), &event) == -1) {
+            LOG_ERROR("epoll_ctl failed");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+}   // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+void signal_handler(int) {
+    running = 0;
+}
+
+int main(int argc, const char** argv)
+{
+    if (argc < 2) {
         return 1;
     }
 
+    /*
+     * socket creation and epoll boilerplate
+     */
+
+    signal(SIGINT, signal_handler);
+
+    const ServerEnv env;
+
+    std::vector<std::unique_ptr<EventLoop>> loops;
+    for (size_t i = 0; i < env.loop_threads; ++i) {
+        loops.push_back(std::make_unique<EventLoop>());
+        loops.back()->id = i;
+        if (!::bootstrap(*loops.back(), argv[1], env.loop_threads > 1, env.use_io_uring)) {
+            return 1;
+        }
+    }
+
     /*
      * handler function
      */
 
-    // TODO on-disk storage
-//    std::unordered_map<std::string, uint64_t> storage;
-    Storage storage;
-    PersistentStorage storage_;
-    std::unordered_map<int, std::queue<std::string>> states_put_requests;
-    std::mutex put_request_queue_mutex, state_output_queue_mutex;
+    StorageOptions storage_options;
+    storage_options.cache_size = env.cache_size / env.storage_shards;
+    storage_options.ordered_index = env.ordered_index;
+    storage_options.compression = env.compression;
+    storage_options.compression_min_size = env.compression_min_size;
+    storage_options.segment_size = env.segment_size;
+    storage_options.preallocate = env.preallocate_segments;
+    storage_options.direct_io = env.direct_io;
+    storage_options.replication = env.replication_buffer_size > 0;
+    Sharded<Storage> storage(env.storage_shards, "", storage_options);
+    Sharded<PersistentStorage> storage_(env.storage_shards, "numbers");
+    GroupCommit commit(env.commit_batch_size, env.commit_latency);
+    CommitMetrics commit_metrics;
+    const FlowLimits flow_limits{env.max_outstanding_responses, env.max_output_bytes};
+    // after the storage and the loops: its destructor still runs queued reads
+    WorkerPool disk_pool(env.disk_threads, env.max_queued_reads);
+    std::unique_ptr<ReplicationLog> replication_log;
+    if (env.replication_buffer_size > 0) {
+        replication_log = std::make_unique<ReplicationLog>(env.replication_buffer_size);
+    }
+    ReplicationMetrics replication_metrics;
+
+    // Syncs the storage and hands what became durable to the replication
+    // stream. Serialized, since the committer and a follower's replication
+    // thread both sync, and the stream must follow the order of the syncs.
+    std::mutex sync_mutex;
+    auto sync_storage = [&] {
+        std::lock_guard<std::mutex> guard(sync_mutex);
+        std::string records;
+        if (replication_log) {
+            storage.for_each([&] (Storage& shard) {
+                shard.take_appended_records(&records);
+            });
+        }
 
-    auto handle_get_number = [&] (const std::string& request) {
-        NProto::TGetNumberRequest get_request;
+        storage.sync();
+        if (replication_log) {
+            replication_log->append(std::move(records));
+        }
+    };
+
+    // Hands the response to the committer, which sends it once the write
+    // before it is durable.
+    auto defer_response = [&] (EventLoop& loop, int fd, std::string* response) {
+        auto completion = begin_completion(loop.id, loop.states.at(fd));
+        completion.response = std::move(*response);
+        commit.add(std::move(completion));
+        response->clear();
+    };
+
+    auto handle_get_number = [&] (std::string_view request, std::string* response) {
+        auto& get_request = messages.get_number_request;
         if (!get_request.ParseFromArray(request.data(), request.size())) {
             // TODO proper handling
 
@@ -226,22 +657,24 @@ int main(int argc, const char** argv)
 
         LOG_DEBUG_S("get_number_request: " << get_request.ShortDebugString());
 
-        NProto::TGetNumberResponse get_response;
+        auto& get_response = messages.get_number_response;
+        get_response.Clear();
         get_response.set_request_id(get_request.request_id());
-        auto p = storage_.find(get_request.key());
-        if (p != nullptr) {
-            get_response.set_offset(*p);
+        uint64_t offset;
+        if (storage_.shard(get_request.key()).find(get_request.key(), &offset)) {
+            get_response.set_offset(offset);
         }
 
-        std::stringstream response;
-        serialize_header(GET_NUMBER_RESPONSE, get_response.ByteSizeLong(), response);
-        get_response.SerializeToOstream(&response);
-
-        return response.str();
+        serialize(GET_NUMBER_RESPONSE, get_response, response);
     };
 
-    auto handle_put_number = [&] (int fd, const std::string& request) {
-        NProto::TPutNumberRequest put_request;
+    auto handle_put_number = [&] (
+        EventLoop& loop,
+        int fd,
+        std::string_view request,
+        std::string* response)
+    {
+        auto& put_request = messages.put_number_request;
         if (!put_request.ParseFromArray(request.data(), request.size())) {
             // TODO proper handling
 
@@ -250,25 +683,43 @@ int main(int argc, const char** argv)
 
         LOG_DEBUG_S("put_number_request: " << put_request.ShortDebugString());
 
-        storage_.put(put_request.key(), put_request.offset());
+        storage_.shard(put_request.key()).put(put_request.key(), put_request.offset());
 
-        NProto::TPutNumberResponse put_response;
+        auto& put_response = messages.put_number_response;
+        put_response.Clear();
         put_response.set_request_id(put_request.request_id());
 
-        std::stringstream response;
-        serialize_header(PUT_NUMBER_RESPONSE, put_response.ByteSizeLong(), response);
-        put_response.SerializeToOstream(&response);
-
-        std::lock_guard<std::mutex> guard(put_request_queue_mutex);
-        states_put_requests[fd].push(response.str());
-
-        std::string r;
+        serialize(PUT_NUMBER_RESPONSE, put_response, response);
+        defer_response(loop, fd, response);
+    };
 
-        return r;
+    // Runs `read` on a disk thread, which completes the response it
+    // serializes. Must follow a successful disk_pool.reserve().
+    auto read_on_disk = [&] (
+        EventLoop& loop,
+        int fd,
+        std::function<void(std::string*)> read)
+    {
+        auto completion = begin_completion(loop.id, loop.states.at(fd));
+        disk_pool.submit([&, read = std::move(read), completion = std::move(completion)] () mutable {
+            read(&completion.response);
+
+            const auto owner = completion.owner;
+            std::vector<Completion> completions;
+            completions.push_back(std::move(completion));
+            loops[owner]->completions->complete(std::move(completions));
+        });
     };
 
-    auto handle_get = [&] (const std::string& request) {
-        NProto::TGetRequest get_request;
+    // Values that would block on the disk are read by disk_pool, everything
+    // else inline.
+    auto handle_get = [&] (
+        EventLoop& loop,
+        int fd,
+        std::string_view request,
+        std::string* response)
+    {
+        auto& get_request = messages.get_request;
         if (!get_request.ParseFromArray(request.data(), request.size())) {
             // TODO proper handling
 
@@ -277,22 +728,46 @@ int main(int argc, const char** argv)
 
         LOG_DEBUG_S("get_request: " << get_request.ShortDebugString());
 
-        NProto::TGetResponse get_response;
+        auto& get_response = messages.get_response;
+        get_response.Clear();
         get_response.set_request_id(get_request.request_id());
 
-        std::string ret;
-        if (storage.get(get_request.key(), &ret))
-            get_response.set_value(ret);
+        auto& shard = storage.shard(get_request.key());
+        bool cold = false;
+        shard.get_if_resident(get_request.key(), get_response.mutable_value(), &cold);
+        if (cold) {
+            if (disk_pool.reserve()) {
+                {
+                    std::lock_guard<std::mutex> guard(loop.metrics.mutex);
+                    ++loop.metrics.cold_reads;
+                }
 
-        std::stringstream response;
-        serialize_header(GET_RESPONSE, get_response.ByteSizeLong(), response);
-        get_response.SerializeToOstream(&response);
+                read_on_disk(loop, fd, [shard = &shard, key = get_request.key(),
+                        request_id = get_request.request_id()] (std::string* response) {
+                    // this thread's own messages
+                    auto& get_response = messages.get_response;
+                    get_response.Clear();
+                    get_response.set_request_id(request_id);
+                    shard->get_cold(key, get_response.mutable_value());
+                    serialize(GET_RESPONSE, get_response, response);
+                });
+                response->clear();
+                return;
+            }
+            // the disk threads are backed up: don't queue without bound
+            shard.get_cold(get_request.key(), get_response.mutable_value());
+        }
 
-        return response.str();
+        serialize(GET_RESPONSE, get_response, response);
     };
 
-    auto handle_put = [&] (int fd, const std::string& request) {
-        NProto::TPutRequest put_request;
+    auto handle_put = [&] (
+        EventLoop& loop,
+        int fd,
+        std::string_view request,
+        std::string* response)
+    {
+        auto& put_request = messages.put_request;
         if (!put_request.ParseFromArray(request.data(), request.size())) {
             // TODO proper handling
 
@@ -301,134 +776,934 @@ int main(int argc, const char** argv)
 
         LOG_DEBUG_S("put_request2: " << put_request.ShortDebugString());
 
-        storage.put(put_request.key(), put_request.value());
+        storage.shard(put_request.key()).put(put_request.key(), put_request.value());
 
-        NProto::TPutResponse put_response;
+        auto& put_response = messages.put_response;
+        put_response.Clear();
         put_response.set_request_id(put_request.request_id());
 
-        std::stringstream response;
-        serialize_header(PUT_RESPONSE, put_response.ByteSizeLong(), response);
-        put_response.SerializeToOstream(&response);
+        serialize(PUT_RESPONSE, put_response, response);
+        defer_response(loop, fd, response);
+    };
+
+    auto handle_multi_get = [&] (std::string_view request, std::string* response) {
+        auto& get_request = messages.multi_get_request;
+        if (!get_request.ParseFromArray(request.data(), request.size())) {
+            // TODO proper handling
+
+            abort();
+        }
+
+        LOG_DEBUG_S("multi_get_request: " << get_request.ShortDebugString());
+
+        auto& get_response = messages.multi_get_response;
+        get_response.Clear();
+        get_response.set_request_id(get_request.request_id());
+
+        auto& keys = messages.shard_keys;
+        auto& values = messages.shard_values;
+        keys.resize(storage.size());
+        values.resize(storage.size());
+        for (const auto& key: get_request.keys()) {
+            const auto i = storage.shard_index(key);
+            keys[i].push_back(&key);
+            values[i].push_back(get_response.add_values());
+        }
+
+        for (size_t i = 0; i < storage.size(); ++i) {
+            if (!keys[i].empty()) {
+                storage.at(i).multi_get(keys[i], values[i]);
+                keys[i].clear();
+                values[i].clear();
+            }
+        }
+
+        serialize(MULTI_GET_RESPONSE, get_response, response);
+    };
+
+    auto handle_multi_put = [&] (
+        EventLoop& loop,
+        int fd,
+        std::string_view request,
+        std::string* response)
+    {
+        auto& put_request = messages.multi_put_request;
+        if (!put_request.ParseFromArray(request.data(), request.size())) {
+            // TODO proper handling
+
+            abort();
+        }
+
+        LOG_DEBUG_S("multi_put_request: " << put_request.ShortDebugString());
+
+        auto& kvs = messages.shard_kvs;
+        kvs.resize(storage.size());
+        for (const auto& kv: put_request.kvs()) {
+            kvs[storage.shard_index(kv.key())].emplace_back(&kv.key(), &kv.value());
+        }
+
+        for (size_t i = 0; i < storage.size(); ++i) {
+            if (!kvs[i].empty()) {
+                storage.at(i).multi_put(kvs[i]);
+                kvs[i].clear();
+            }
+        }
+
+        auto& put_response = messages.multi_put_response;
+        put_response.Clear();
+        put_response.set_request_id(put_request.request_id());
+
+        // a single ack: the whole batch is acknowledged by one group commit
+        serialize(MULTI_PUT_RESPONSE, put_response, response);
+        defer_response(loop, fd, response);
+    };
+
+    // Serializes the chunks answering a scan into `response`: the range is
+    // scanned in every shard and the shards' keys are merged.
+    auto scan = [&] (const NProto::TScanRequest& scan_request, std::string* response) {
+        const size_t limit = scan_request.limit() == 0
+            ? ::max_scan_keys
+            : std::min<size_t>(scan_request.limit(), ::max_scan_keys);
+
+        // one more to tell whether the range goes on
+        std::vector<std::string> keys;
+        storage.for_each([&] (Storage& shard) {
+            shard.scan_keys(scan_request.start_key(), scan_request.end_key(), limit + 1, &keys);
+        });
+        std::sort(keys.begin(), keys.end());
+
+        auto& scan_response = messages.scan_response;
+        scan_response.Clear();
+        scan_response.set_request_id(scan_request.request_id());
+
+        response->clear();
+        std::string chunk;
+        size_t chunk_bytes = 0;
+        for (size_t i = 0; i < std::min(limit, keys.size()); ++i) {
+            auto* kv = scan_response.add_kvs();
+            if (!storage.shard(keys[i]).get(keys[i], kv->mutable_value())) {
+                // keys are never deleted, yet don't answer with a made-up value
+                scan_response.mutable_kvs()->RemoveLast();
+                continue;
+            }
+            kv->set_key(keys[i]);
+
+            chunk_bytes += kv->key().size() + kv->value().size();
+            if (chunk_bytes >= ::scan_chunk_bytes) {
+                serialize(SCAN_RESPONSE, scan_response, &chunk);
+                response->append(chunk);
+                scan_response.clear_kvs();
+                chunk_bytes = 0;
+            }
+        }
+
+        scan_response.set_last(true);
+        if (keys.size() > limit) {
+            scan_response.set_next_key(keys[limit]);
+        }
+        serialize(SCAN_RESPONSE, scan_response, &chunk);
+        response->append(chunk);
+    };
+
+    // Scans may read many cold values, so they go to the disk threads when
+    // there is room.
+    auto handle_scan = [&] (
+        EventLoop& loop,
+        int fd,
+        std::string_view request,
+        std::string* response)
+    {
+        auto& scan_request = messages.scan_request;
+        if (!scan_request.ParseFromArray(request.data(), request.size())) {
+            // TODO proper handling
+
+            abort();
+        }
+
+        LOG_DEBUG_S("scan_request: " << scan_request.ShortDebugString());
+
+        if (!env.ordered_index) {
+            LOG_ERROR("scan with ORDERED_INDEX=0");
+            auto& scan_response = messages.scan_response;
+            scan_response.Clear();
+            scan_response.set_request_id(scan_request.request_id());
+            scan_response.set_status(NProto::TScanResponse::UNSUPPORTED);
+            scan_response.set_last(true);
+            serialize(SCAN_RESPONSE, scan_response, response);
+            return;
+        }
+
+        if (disk_pool.reserve()) {
+            read_on_disk(loop, fd, [&, scan_request = scan_request] (std::string* response) {
+                scan(scan_request, response);
+            });
+            response->clear();
+            return;
+        }
+
+        scan(scan_request, response);
+    };
+
+    auto handle_replicate = [&] (std::string_view request, std::string* response) {
+        auto& replicate_request = messages.replicate_request;
+        if (!replicate_request.ParseFromArray(request.data(), request.size())) {
+            // TODO proper handling
+
+            abort();
+        }
+
+        LOG_DEBUG_S("replicate_request: " << replicate_request.ShortDebugString());
+
+        auto& replicate_response = messages.replicate_response;
+        replicate_response.Clear();
+        replicate_response.set_request_id(replicate_request.request_id());
+
+        if (replication_log) {
+            const size_t max_bytes = replicate_request.max_bytes() == 0
+                ? ::replication_batch_bytes
+                : replicate_request.max_bytes();
+            replicate_response.set_stream_id(replication_log->stream_id());
+            replicate_response.set_found(replication_log->read(
+                replicate_request.stream_id(),
+                replicate_request.position(),
+                max_bytes,
+                replicate_response.mutable_records()));
+            replicate_response.set_end_position(replication_log->end_position());
+        } else {
+            LOG_ERROR("replicate request with REPLICATION_BUFFER_MB=0");
+        }
+
+        serialize(REPLICATE_RESPONSE, replicate_response, response);
+    };
+
+    auto handle_stats = [&] (std::string_view request, std::string* response) {
+        NProto::TStatsRequest stats_request;
+        if (!stats_request.ParseFromArray(request.data(), request.size())) {
+            // TODO proper handling
+
+            abort();
+        }
 
-        std::lock_guard<std::mutex> guard(put_request_queue_mutex);
-        states_put_requests[fd].push(response.str());
+        NProto::TStatsResponse stats_response;
+        stats_response.set_request_id(stats_request.request_id());
 
-        std::string r;
+        std::array<uint64_t, LoopMetrics::max_types> requests = {};
+        std::vector<NMetrics::Histogram> latency(LoopMetrics::max_types);
+        for (auto& loop: loops) {
+            std::lock_guard<std::mutex> guard(loop->metrics.mutex);
+            for (size_t type = 0; type < LoopMetrics::max_types; ++type) {
+                requests[type] += loop->metrics.requests[type];
+                latency[type].merge(loop->metrics.handler_latency_ns[type]);
+            }
+            add_counter("loop" + std::to_string(loop->id) + ".connections",
+                loop->metrics.connections, &stats_response);
+            add_counter("loop" + std::to_string(loop->id) + ".pauses",
+                loop->metrics.pauses, &stats_response);
+            add_counter("loop" + std::to_string(loop->id) + ".cold_reads",
+                loop->metrics.cold_reads, &stats_response);
+        }
+
+        for (size_t type = 0; type < LoopMetrics::max_types; ++type) {
+            if (request_name(type) && requests[type]) {
+                add_counter(std::string(request_name(type)) + ".requests",
+                    requests[type], &stats_response);
+                add_histogram(std::string(request_name(type)) + ".handler_latency_ns",
+                    latency[type], &stats_response);
+            }
+        }
+
+        add_counter("commit.pending", commit.pending(), &stats_response);
+        add_counter("disk.pending", disk_pool.pending(), &stats_response);
+        {
+            std::lock_guard<std::mutex> guard(commit_metrics.mutex);
+            add_histogram("commit.batch_size", commit_metrics.batch_size, &stats_response);
+            add_histogram("commit.sync_us", commit_metrics.sync_us, &stats_response);
+            add_histogram("commit.ack_latency_us", commit_metrics.ack_latency_us, &stats_response);
+        }
+
+        Storage::Usage usage;
+        uint64_t cache_hits = 0, cache_misses = 0;
+        storage.for_each([&] (Storage& shard) {
+            const auto u = shard.usage();
+            usage.segments += u.segments;
+            usage.total_bytes += u.total_bytes;
+            usage.dead_bytes += u.dead_bytes;
+            usage.appended_bytes += u.appended_bytes;
+            usage.filtered_lookups += u.filtered_lookups;
+            usage.compression_saved_bytes += u.compression_saved_bytes;
+            cache_hits += shard.value_cache().hit_count();
+            cache_misses += shard.value_cache().miss_count();
+        });
+        add_counter("storage.segments", usage.segments, &stats_response);
+        add_counter("storage.bytes", usage.total_bytes, &stats_response);
+        add_counter("storage.dead_bytes", usage.dead_bytes, &stats_response);
+        add_counter("storage.appended_bytes", usage.appended_bytes, &stats_response);
+        add_counter("storage.filtered_lookups", usage.filtered_lookups, &stats_response);
+        add_counter("storage.compression_saved_bytes", usage.compression_saved_bytes, &stats_response);
+        uint64_t numbers_filtered = 0;
+        storage_.for_each([&] (PersistentStorage& shard) {
+            numbers_filtered += shard.filtered_count();
+        });
+        add_counter("numbers.filtered_lookups", numbers_filtered, &stats_response);
+        add_counter("cache.hits", cache_hits, &stats_response);
+        add_counter("cache.misses", cache_misses, &stats_response);
+
+        if (replication_log) {
+            add_counter("replication.stream_position",
+                replication_log->end_position(), &stats_response);
+            add_counter("replication.buffered_bytes",
+                replication_log->buffered_bytes(), &stats_response);
+        }
+
+        if (!env.replicate_from.empty()) {
+            std::lock_guard<std::mutex> guard(replication_metrics.mutex);
+            const auto& m = replication_metrics;
+            const bool behind = m.position < m.primary_position;
+            add_counter("replication.connected", m.connected, &stats_response);
+            add_counter("replication.position", m.position, &stats_response);
+            add_counter("replication.lag_bytes",
+                behind ? m.primary_position - m.position : 0, &stats_response);
+            add_counter("replication.lag_us", behind
+                ? std::chrono::duration_cast<std::chrono::microseconds>(
+                    ReplicationMetrics::Clock::now() - m.caught_up).count()
+                : 0, &stats_response);
+            add_counter("replication.applied_bytes", m.applied_bytes, &stats_response);
+            add_counter("replication.resyncs", m.resyncs, &stats_response);
+        }
 
-        return r;
+        serialize(STATS_RESPONSE, stats_response, response);
     };
 
-    Handler handler = [&] (int fd, char request_type, const std::string& request) {
+    auto dispatch = [&] (
+        EventLoop& loop,
+        int fd,
+        char request_type,
+        std::string_view request,
+        std::string* response)
+    {
         switch (request_type) {
-            case PUT_REQUEST: return handle_put(fd, request);
-            case GET_REQUEST: return handle_get(request);
-            case PUT_NUMBER_REQUEST: return handle_put_number(fd, request);
-            case GET_NUMBER_REQUEST: return handle_get_number(request);
+            case PUT_REQUEST: return handle_put(loop, fd, request, response);
+            case GET_REQUEST: return handle_get(loop, fd, request, response);
+            case PUT_NUMBER_REQUEST: return handle_put_number(loop, fd, request, response);
+            case GET_NUMBER_REQUEST: return handle_get_number(request, response);
+            case MULTI_PUT_REQUEST: return handle_multi_put(loop, fd, request, response);
+            case MULTI_GET_REQUEST: return handle_multi_get(request, response);
+            case STATS_REQUEST: return handle_stats(request, response);
+            case SCAN_REQUEST: return handle_scan(loop, fd, request, response);
+            case REPLICATE_REQUEST: return handle_replicate(request, response);
         }
 
         // TODO proper handling
 
         abort();
-        return std::string();
+    };
+
+    auto make_handler = [&] (EventLoop& loop) -> Handler {
+        return [&] (
+            int fd,
+            char request_type,
+            std::string_view request,
+            std::string* response)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            dispatch(loop, fd, request_type, request, response);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start);
+
+            // dispatch() only returns for known types
+            const auto type = static_cast<unsigned char>(request_type);
+            std::lock_guard<std::mutex> guard(loop.metrics.mutex);
+            ++loop.metrics.requests[type];
+            loop.metrics.handler_latency_ns[type].record(elapsed.count());
+        };
     };
 
     /*
-     * rpc state and event loop
-     * TODO extract into struct Rpc
+     * committer: syncs batches of PUTs and sends their acks
      */
 
-    std::array<struct epoll_event, ::max_events> events;
-    std::unordered_map<int, SocketStatePtr> states;
+    std::thread put_requests_thread(
+            [&]() {
+                std::vector<std::vector<Completion>> acks(loops.size());
+                while (running) {
+                    auto batch = commit.wait_batch(::commit_poll_timeout);
+                    if (batch.empty()) {
+                        continue;
+                    }
 
-    auto finalize = [&] (int fd) {
-        LOG_INFO_S("close " << fd);
+                    const auto sync_start = std::chrono::steady_clock::now();
+                    storage_.sync();
+                    sync_storage();
+                    const auto synced = std::chrono::steady_clock::now();
+
+                    {
+                        std::lock_guard<std::mutex> guard(commit_metrics.mutex);
+                        commit_metrics.batch_size.record(batch.size());
+                        commit_metrics.sync_us.record(
+                            std::chrono::duration_cast<std::chrono::microseconds>(
+                                synced - sync_start).count());
+                        for (const auto& ack: batch) {
+                            commit_metrics.ack_latency_us.record(
+                                std::chrono::duration_cast<std::chrono::microseconds>(
+                                    synced - ack.added).count());
+                        }
+                    }
 
-        close(fd);
-        states.erase(fd);
-        states_put_requests.erase(fd);
-    };
+                    for (auto& ack: batch) {
+                        acks[ack.completion.owner].push_back(std::move(ack.completion));
+                    }
 
-    std::thread put_requests_thread(
+                    for (size_t i = 0; i < loops.size(); ++i) {
+                        if (!acks[i].empty()) {
+                            loops[i]->completions->complete(std::move(acks[i]));
+                            acks[i] = {};
+                        }
+                    }
+                }
+            }
+            );
+
+    /*
+     * compactor: reclaims segments full of overwritten records
+     */
+
+    std::thread compaction_thread(
             [&]() {
                 while (running) {
-                    storage.sync();
-                    for(auto &item: states_put_requests) {
-                        auto &q = states_put_requests[item.first];
-                        auto state = states.at(item.first);
-                        std::lock_guard<std::mutex> guard2(state_output_queue_mutex);
-                        std::lock_guard<std::mutex> guard(put_request_queue_mutex);
-                        while(!q.empty()) {
-                            state->output_queue.push_back(q.front());
-                            q.pop();
+                    // bounds both the journal replay at startup and its size
+                    storage.for_each([&] (Storage& shard) {
+                        shard.checkpoint(env.checkpoint_journal_size);
+                    });
+                    storage_.for_each([&] (PersistentStorage& shard) {
+                        if (shard.journal_size() >= env.checkpoint_journal_size) {
+                            shard.checkpoint();
                         }
-                        process_output(*state);
+                    });
+
+                    uint64_t scanned = 0;
+                    storage.for_each([&] (Storage& shard) {
+                        scanned += shard.compact(
+                            ::compaction_step_bytes,
+                            env.compaction_min_dead_percent);
+                    });
+
+                    if (scanned == 0) {
+                        std::this_thread::sleep_for(::compaction_poll_timeout);
+                    } else {
+                        // rate limit so as not to swamp foreground I/O
+                        std::this_thread::sleep_for(std::chrono::microseconds(
+                            scanned * 1000000 / env.compaction_rate));
                     }
-                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
                 }
             }
             );
 
-    while (running) {
-        const auto n = epoll_wait(epollfd, events.data(), ::max_events, -1);
+    /*
+     * follower: applies the replication stream of the primary
+     */
 
-        {
-            LOG_INFO_S("got " << n << " events");
-        }
+    // Copies every key of the primary with SCANs, for a follower that has
+    // no position in the primary's current stream. Values may be newer than
+    // the position the stream then continues from, replaying it brings every
+    // key back to its latest value.
+    auto copy_primary = [&] (PrimaryConnection& primary, uint64_t* request_id) {
+        NProto::TScanRequest scan_request;
+        NProto::TScanResponse scan_response;
+        scan_request.set_limit(::max_scan_keys);
+        do {
+            scan_request.set_request_id(++*request_id);
+            if (!primary.send(SCAN_REQUEST, scan_request)) {
+                return false;
+            }
 
-        for (int i = 0; i < n; ++i) {
-            const auto fd = events[i].data.fd;
+            do {
+                if (!primary.receive(SCAN_RESPONSE, &scan_response)) {
+                    return false;
+                }
 
-            if (events[i].events & EPOLLERR
-                    || events[i].events & EPOLLHUP
-                    || !(events[i].events & (EPOLLIN | EPOLLOUT)))
-            {
-                LOG_ERROR_S("epoll event error on fd " << fd);
+                if (scan_response.status() != NProto::TScanResponse::OK) {
+                    // what was copied so far stays, the next copy redoes it
+                    LOG_ERROR_S(env.replicate_from << " can't be copied, scan status "
+                        << NProto::TScanResponse::EStatus_Name(scan_response.status()));
+                    return false;
+                }
+
+                for (const auto& kv: scan_response.kvs()) {
+                    storage.shard(kv.key()).put(kv.key(), kv.value());
+                }
+            } while (!scan_response.last());
+
+            sync_storage();
+            scan_request.set_start_key(scan_response.next_key());
+        } while (!scan_response.next_key().empty() && running);
+
+        return static_cast<bool>(running);
+    };
+
+    std::thread replication_thread(
+            [&]() {
+                if (env.replicate_from.empty()) {
+                    return;
+                }
+
+                ReplicaState replica;
+                replica.load(::replica_state_filename);
+                PrimaryConnection primary;
+                NProto::TReplicateRequest request;
+                NProto::TReplicateResponse response;
+                uint64_t request_id = 0;
+
+                auto disconnect = [&] {
+                    primary.close();
+                    std::lock_guard<std::mutex> guard(replication_metrics.mutex);
+                    replication_metrics.connected = false;
+                };
+
+                while (running) {
+                    if (!primary.connected()) {
+                        if (!primary.connect(env.replicate_from, ::replication_timeout)) {
+                            std::this_thread::sleep_for(::replication_retry_timeout);
+                            continue;
+                        }
 
-                finalize(fd);
+                        LOG_INFO_S("replicating " << env.replicate_from);
+                        std::lock_guard<std::mutex> guard(replication_metrics.mutex);
+                        replication_metrics.connected = true;
+                    }
+
+                    request.set_request_id(++request_id);
+                    request.set_stream_id(replica.stream_id);
+                    request.set_position(replica.position);
+                    request.set_max_bytes(::replication_batch_bytes);
+                    if (!primary.send(REPLICATE_REQUEST, request)
+                            || !primary.receive(REPLICATE_RESPONSE, &response))
+                    {
+                        disconnect();
+                        continue;
+                    }
+
+                    if (!response.found()) {
+                        if (response.stream_id() == 0) {
+                            LOG_ERROR_S(env.replicate_from << " has REPLICATION_BUFFER_MB=0");
+                            disconnect();
+                            std::this_thread::sleep_for(::replication_retry_timeout);
+                            continue;
+                        }
+
+                        LOG_INFO_S("copying the storage of " << env.replicate_from);
+                        if (!copy_primary(primary, &request_id)) {
+                            disconnect();
+                            std::this_thread::sleep_for(::replication_retry_timeout);
+                            continue;
+                        }
+
+                        replica.stream_id = response.stream_id();
+                        replica.position = response.end_position();
+                        replica.save(::replica_state_filename);
+                        std::lock_guard<std::mutex> guard(replication_metrics.mutex);
+                        ++replication_metrics.resyncs;
+                        continue;
+                    }
+
+                    const auto& records = response.records();
+                    const bool applied = Storage::for_each_record(records.data(), records.size(),
+                        [&] (const std::string& key, const std::string& value) {
+                            storage.shard(key).put(key, value);
+                        });
+                    if (!applied) {
+                        // the part that was applied will be again
+                        LOG_ERROR("malformed replication records");
+                        disconnect();
+                        continue;
+                    }
+
+                    if (!records.empty()) {
+                        sync_storage();
+                        replica.position += records.size();
+                        replica.save(::replica_state_filename);
+                    }
+
+                    const bool caught_up = replica.position >= response.end_position();
+                    {
+                        std::lock_guard<std::mutex> guard(replication_metrics.mutex);
+                        auto& m = replication_metrics;
+                        m.position = replica.position;
+                        m.primary_position = response.end_position();
+                        m.applied_bytes += records.size();
+                        if (caught_up) {
+                            m.caught_up = ReplicationMetrics::Clock::now();
+                        }
+                    }
+
+                    if (caught_up) {
+                        std::this_thread::sleep_for(env.replication_poll);
+                    }
+                }
+            }
+            );
+
+    /*
+     * rpc state and event loop
+     * TODO extract into struct Rpc
+     */
+
+    auto run_loop = [&] (EventLoop& loop) {
+        std::array<struct epoll_event, ::max_events> events;
+        struct epoll_event event;
+        const Handler handler = make_handler(loop);
+
+        auto finalize = [&] (int fd) {
+            LOG_INFO_S("close " << fd);
+
+            close(fd);
+            auto it = loop.states.find(fd);
+            if (it != loop.states.end()) {
+                // acks for this state may still be on their way back
+                it->second->fd = -1;
+                loop.states.erase(it);
+                loop.unarmed.erase(fd);
+                loop.update_connections();
+            }
+        };
+
+        while (running) {
+            const auto n = epoll_wait(
+                loop.epollfd,
+                events.data(),
+                ::max_events,
+                ::loop_poll_timeout_ms);
 
+            if (n == 0) {
                 continue;
             }
 
-            if (socketfd == fd) {
-                while (true) {
-                    auto state = ::accept_connection(socketfd, event, epollfd);
-                    if (!state) {
-                        break;
+            {
+                LOG_DEBUG_S("got " << n << " events");
+            }
+
+            for (int i = 0; i < n; ++i) {
+                const auto fd = events[i].data.fd;
+
+                if (fd == loop.completions->fd()) {
+                    uint64_t value;
+                    if (read(fd, &value, sizeof(value)) == -1 && errno != EAGAIN) {
+                        LOG_PERROR("eventfd read failed");
                     }
 
-                    states[state->fd] = state;
-                    states_put_requests[state->fd] = std::queue<std::string>();
+                    for (auto& state: loop.completions->take()) {
+                        if (!process_output(*state)) {
+                            finalize(state->fd);
+                        } else {
+                            update_flow(loop, *state, flow_limits);
+                        }
+                    }
+
+                    continue;
                 }
 
-                continue;
+                if (events[i].events & EPOLLERR
+                        || events[i].events & EPOLLHUP
+                        || !(events[i].events & (EPOLLIN | EPOLLOUT)))
+                {
+                    LOG_ERROR_S("epoll event error on fd " << fd);
+
+                    finalize(fd);
+
+                    continue;
+                }
+
+                if (loop.socketfd == fd) {
+                    while (true) {
+                        auto state = ::accept_connection(loop.socketfd, event, loop.epollfd);
+                        if (!state) {
+                            break;
+                        }
+
+                        loop.states[state->fd] = state;
+                    }
+                    loop.update_connections();
+
+                    continue;
+                }
+
+                auto state = loop.states.at(fd);
+                bool closed = false;
+                if (events[i].events & EPOLLIN) {
+                    if (!process_input(*state, handler, flow_limits)) {
+                        LOG_INFO_S("FINILIZING1");
+                        finalize(fd);
+                        closed = true;
+                    }
+                } else if (!state->paused) {
+                    // just resumed: what was read before the pause comes first
+                    process_messages(*state, handler, flow_limits);
+                }
+
+                if (events[i].events & EPOLLOUT && !closed) {
+                    if (!process_output(*state)) {
+                        LOG_INFO_S("FINILIZING2")
+                        finalize(fd);
+                        closed = true;
+                    }
+                }
+
+                if (!closed) {
+                    update_flow(loop, *state, flow_limits);
+                }
             }
+        }
+    };
 
+    // io_uring engine: recv and sendmsg are submitted as ring entries; all
+    // entries prepared while handling a round of completions go to the kernel
+    // with the same io_uring_enter that waits for the next round
+    auto run_uring_loop = [&] (EventLoop& loop) {
+        enum EOp : uint64_t
+        {
+            OP_ACCEPT = 0,
+            OP_WAKE = 1,
+            OP_RECV = 2,
+            OP_SEND = 3,
+        };
+        constexpr uint64_t op_mask = 3;
+
+        struct Connection
+        {
+            SocketStatePtr state;
+            bool receiving = false;
+            bool sending = false;
             bool closed = false;
-            if (events[i].events & EPOLLIN) {
-                auto state = states.at(fd);
-                std::lock_guard<std::mutex> guard(state_output_queue_mutex);
-                if (!process_input(*state, handler)) {
-                    LOG_INFO_S("FINILIZING1");
-                    finalize(fd);
-                    closed = true;
+            // must stay put while a sendmsg is in flight
+            std::array<struct iovec, max_output_iovecs> iov;
+            struct msghdr msg = {};
+        };
+
+        Uring& ring = *loop.ring;
+        const Handler handler = make_handler(loop);
+        // owns connections until their last in-flight entry completes
+        std::unordered_map<Connection*, std::unique_ptr<Connection>> connections;
+        std::unordered_map<int, Connection*> open_connections;
+        std::vector<Connection*> to_flush;
+        uint64_t wake_value = 0;
+
+        auto get_sqe = [&] {
+            struct io_uring_sqe* sqe;
+            while (!(sqe = ring.get_sqe())) {
+                ring.submit_and_wait(0, std::chrono::milliseconds(0));
+            }
+            return sqe;
+        };
+
+        auto tag = [] (Connection* conn, EOp op) {
+            return reinterpret_cast<uint64_t>(conn) | op;
+        };
+
+        auto arm_accept = [&] {
+            auto* sqe = get_sqe();
+            sqe->opcode = IORING_OP_ACCEPT;
+            sqe->fd = loop.socketfd;
+            sqe->accept_flags = SOCK_CLOEXEC;
+            sqe->user_data = OP_ACCEPT;
+        };
+
+        auto arm_wake = [&] {
+            auto* sqe = get_sqe();
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = loop.completions->fd();
+            sqe->addr = reinterpret_cast<uint64_t>(&wake_value);
+            sqe->len = sizeof(wake_value);
+            sqe->user_data = OP_WAKE;
+        };
+
+        auto arm_recv = [&] (Connection* conn) {
+            auto [buf, len] = conn->state->input.tail();
+            auto* sqe = get_sqe();
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = conn->state->fd;
+            sqe->addr = reinterpret_cast<uint64_t>(buf);
+            sqe->len = len;
+            sqe->user_data = tag(conn, OP_RECV);
+            conn->receiving = true;
+        };
+
+        auto arm_send = [&] (Connection* conn) {
+            size_t len = 0;
+            conn->msg.msg_iov = conn->iov.data();
+            conn->msg.msg_iovlen = prepare_output(*conn->state, conn->iov, &len);
+            auto* sqe = get_sqe();
+            sqe->opcode = IORING_OP_SENDMSG;
+            sqe->fd = conn->state->fd;
+            sqe->addr = reinterpret_cast<uint64_t>(&conn->msg);
+            sqe->len = 1;
+            sqe->msg_flags = MSG_NOSIGNAL;
+            sqe->user_data = tag(conn, OP_SEND);
+            conn->sending = true;
+        };
+
+        // Handles what was received and reads on, unless that put the
+        // connection over its limits: then it waits for OP_SEND to drain it.
+        auto continue_receiving = [&] (Connection* conn) {
+            auto& state = *conn->state;
+            const bool was_paused = state.paused;
+            state.paused = false;
+            process_messages(state, handler, flow_limits);
+            if (!state.paused) {
+                arm_recv(conn);
+            } else if (!was_paused) {
+                std::lock_guard<std::mutex> guard(loop.metrics.mutex);
+                ++loop.metrics.pauses;
+            }
+        };
+
+        auto finalize = [&] (Connection* conn) {
+            if (!conn->closed) {
+                const auto fd = conn->state->fd;
+                LOG_INFO_S("close " << fd);
+
+                // wakes up the pending recv
+                shutdown(fd, SHUT_RDWR);
+                close(fd);
+                open_connections.erase(fd);
+                loop.states.erase(fd);
+                // acks for this state may still be on their way back
+                conn->state->fd = -1;
+                conn->closed = true;
+                loop.update_connections();
+            }
+
+            if (!conn->receiving && !conn->sending) {
+                connections.erase(conn);
+            }
+        };
+
+        auto on_completion = [&] (const struct io_uring_cqe& cqe) {
+            const auto op = static_cast<EOp>(cqe.user_data & op_mask);
+            auto* conn = reinterpret_cast<Connection*>(cqe.user_data & ~op_mask);
+
+            switch (op) {
+                case OP_ACCEPT: {
+                    if (cqe.res < 0) {
+                        LOG_ERROR_S("accept failed: " << strerror(-cqe.res));
+                    } else {
+                        LOG_INFO_S("accepted connection on fd " << cqe.res);
+
+                        auto owned = std::make_unique<Connection>();
+                        owned->state = std::make_shared<SocketState>();
+                        owned->state->fd = cqe.res;
+                        conn = owned.get();
+                        connections[conn] = std::move(owned);
+                        open_connections[cqe.res] = conn;
+                        loop.states[cqe.res] = conn->state;
+                        loop.update_connections();
+                        arm_recv(conn);
+                    }
+                    arm_accept();
+                    break;
+                }
+
+                case OP_WAKE: {
+                    for (auto& state: loop.completions->take()) {
+                        auto it = open_connections.find(state->fd);
+                        if (it != open_connections.end() && it->second->state == state) {
+                            to_flush.push_back(it->second);
+                        }
+                    }
+                    arm_wake();
+                    break;
+                }
+
+                case OP_RECV: {
+                    conn->receiving = false;
+                    if (conn->closed) {
+                        finalize(conn);
+                    } else if (cqe.res <= 0) {
+                        if (cqe.res < 0) {
+                            LOG_ERROR_S("recv failed: " << strerror(-cqe.res));
+                        } else {
+                            LOG_INFO("conn closed");
+                        }
+                        finalize(conn);
+                    } else {
+                        conn->state->input.commit(cqe.res);
+                        continue_receiving(conn);
+                        to_flush.push_back(conn);
+                    }
+                    break;
+                }
+
+                case OP_SEND: {
+                    conn->sending = false;
+                    if (conn->closed) {
+                        finalize(conn);
+                    } else if (cqe.res < 0) {
+                        LOG_ERROR_S("send failed: " << strerror(-cqe.res));
+                        finalize(conn);
+                    } else {
+                        commit_output(*conn->state, cqe.res);
+                        if (conn->state->paused && conn->state->drained(flow_limits)) {
+                            continue_receiving(conn);
+                        }
+                        to_flush.push_back(conn);
+                    }
+                    break;
                 }
             }
+        };
 
-            if (events[i].events & EPOLLOUT && !closed) {
-                auto state = states.at(fd);
-                std::lock_guard<std::mutex> guard(state_output_queue_mutex);
-                if (!process_output(*state)) {
-                    LOG_INFO_S("FINILIZING2")
-                    finalize(fd);
+        arm_accept();
+        arm_wake();
+
+        while (running) {
+            if (!ring.submit_and_wait(1, std::chrono::milliseconds(::loop_poll_timeout_ms))) {
+                break;
+            }
+
+            ring.for_each_completion(on_completion);
+
+            for (auto* conn: to_flush) {
+                if (connections.count(conn) && !conn->closed && !conn->sending
+                        && !conn->state->output_queue.empty())
+                {
+                    arm_send(conn);
                 }
             }
+            to_flush.clear();
         }
+    };
+
+    auto serve = [&] (EventLoop& loop) {
+        if (loop.ring) {
+            run_uring_loop(loop);
+        } else {
+            run_loop(loop);
+        }
+    };
+
+    std::vector<std::thread> loop_threads;
+    for (size_t i = 1; i < loops.size(); ++i) {
+        loop_threads.emplace_back(serve, std::ref(*loops[i]));
     }
+    serve(*loops[0]);
 
     LOG_INFO("exiting");
 
+    for (auto& thread: loop_threads) {
+        thread.join();
+    }
     put_requests_thread.join();
-    close(socketfd);
+    compaction_thread.join();
+    replication_thread.join();
+
+    uint64_t cache_hits = 0, cache_misses = 0;
+    storage.for_each([&] (Storage& shard) {
+        cache_hits += shard.value_cache().hit_count();
+        cache_misses += shard.value_cache().miss_count();
+    });
+    LOG_INFO_S("value cache: " << cache_hits << " hits, " << cache_misses << " misses");
+    for (auto& loop: loops) {
+        close(loop->epollfd);
+        close(loop->socketfd);
+    }
 
     return 0;
 }
@@ -6,7 +6,6 @@
 #include <array>
 #include <cstdlib>
 #include <cstring>
-#include <sstream>
 #include <string>
 
 #include <errno.h>
@@ -100,20 +99,18 @@ int main(int argc, const char** argv) {
         put_request.set_key(key);
         put_request.set_value(v);
 
-        std::stringstream message;
-        serialize_header(PUT_REQUEST, put_request.ByteSizeLong(), message);
-        put_request.SerializeToOstream(&message);
+        std::string message;
+        serialize(PUT_REQUEST, put_request, &message);
 
-        state.output_queue.push_back(message.str());
+        state.queue_output(std::move(message));
     } else {
         NProto::TGetRequest get_request;
         get_request.set_key(key);
 
-        std::stringstream message;
-        serialize_header(GET_REQUEST, get_request.ByteSizeLong(), message);
-        get_request.SerializeToOstream(&message);
+        std::string message;
+        serialize(GET_REQUEST, get_request, &message);
 
-        state.output_queue.push_back(message.str());
+        state.queue_output(std::move(message));
     }
 
     /*
@@ -122,7 +119,7 @@ int main(int argc, const char** argv) {
 
     bool have_response = false;
 
-    auto handle_get = [&] (const std::string& response) {
+    auto handle_get = [&] (std::string_view response) {
         NProto::TGetResponse get_response;
         if (!get_response.ParseFromArray(response.data(), response.size())) {
             // TODO proper handling
@@ -133,11 +130,9 @@ int main(int argc, const char** argv) {
         LOG_INFO_S("get_response: " << get_response.ShortDebugString());
 
         have_response = true;
-
-        return std::string();
     };
 
-    auto handle_put = [&] (const std::string& response) {
+    auto handle_put = [&] (std::string_view response) {
         NProto::TPutResponse put_response;
         if (!put_response.ParseFromArray(response.data(), response.size())) {
             // TODO proper handling
@@ -148,11 +143,14 @@ int main(int argc, const char** argv) {
         LOG_INFO_S("put_response: " << put_response.ShortDebugString());
 
         have_response = true;
-
-        return std::string();
     };
 
-    Handler handler = [&] (int fd, char message_type, const std::string& response) {
+    Handler handler = [&] (
+        int fd,
+        char message_type,
+        std::string_view response,
+        std::string* /*output*/)
+    {
         switch (message_type) {
             case PUT_RESPONSE: return handle_put(response);
             case GET_RESPONSE: return handle_get(response);
@@ -161,7 +159,6 @@ int main(int argc, const char** argv) {
         // TODO proper handling
 
         abort();
-        return std::string();
     };
 
     /*
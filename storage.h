@@ -5,94 +5,520 @@
 #ifndef LOCAL_STORAGE_STORAGE_H
 #define LOCAL_STORAGE_STORAGE_H
 
+#include "bloom_filter.h"
+#include "cache.h"
+#include "compression.h"
+#include "hash_index.h"
+#include "journal.h"
+#include "ordered_keys.h"
+
 #include <unistd.h>
 #include <fcntl.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <deque>
+#include <functional>
 #include <queue>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 
-class PersistentStorage {
+// Persistent key -> Value map. The table itself is an on-disk HashIndex;
+// updates are first appended to a journal (<filename>.log) and applied to the
+// index on sync(), after the journal is durable. The journal is replayed and
+// truncated on startup, so restart only pays for writes since the last
+// clean shutdown. A Bloom filter over the keys of the index, rebuilt from the
+// hashes the index stores on startup, rejects most lookups of missing keys
+// without taking the lock or probing the index. With `ordered` the keys are
+// also kept sorted in memory for scan(), at the cost of reading and sorting
+// all of them on startup.
+//
+// Without `journaled` the caller logs the updates itself: puts and moves skip
+// the journal, sync() only applies them, and after a crash the caller
+// recover()s what it logged since the last checkpoint.
+//
+// `legacy_value` turns the numbers of a text journal, which stores from before
+// the binary journal may still have, into values; false drops the entry. Maps
+// of numbers take them as they are.
+template <typename Value>
+class PersistentMap {
 public:
-    PersistentStorage(const std::string &filename="data.log") {
-        this->filename = filename;
+    using LegacyValue = std::function<bool(const std::string &key, uint64_t number, Value *value)>;
+
+    PersistentMap(const std::string &filename="data", bool ordered=false, bool journaled=true,
+                  LegacyValue legacy_value=nullptr)
+        : index(filename), journaled(journaled), legacy_value(std::move(legacy_value)) {
+        this->filename = filename + ".log";
+        rebuild_filter();
+        if (ordered)
+            load_ordered_keys();
         load_from_disk();
-        file = fopen(filename.c_str(), "a");
-        fd = fileno(file);
     }
-    ~PersistentStorage() {
+    ~PersistentMap() {
         on_shutdown();
     }
 
-    void put(const std::string &key, uint64_t value) {
+    void put(const std::string &key, const Value &value) {
         write_to_disk(key, value);
     }
 
-    uint64_t *find(const std::string &key) {
+    bool find(const std::string &key, Value *value) {
+        uint64_t h = stable_hash(key.data(), key.size());
+        if (!may_contain(h))
+            return false;
+        std::lock_guard<std::mutex> g(mutex);
+        return index.find(key, h, value);
+    }
+
+    // Puts all pairs with a single journal write.
+    void multi_put(const std::vector<const std::string *> &keys, const std::vector<Value> &values) {
+        std::string to_write;
+        for (size_t i = 0; i < keys.size() && journaled; i++)
+            append_journal_record(&to_write, *keys[i], values[i]);
+
+        std::lock_guard<std::mutex> g(mutex);
+        if (journaled && !write_journal(to_write))
+            return;
+        for (size_t i = 0; i < keys.size(); i++)
+            not_confirmed.push_back({*keys[i], values[i]});
+    }
+
+    void multi_find(const std::vector<const std::string *> &keys, std::vector<Value> *values, std::vector<bool> *found) {
+        values->resize(keys.size());
+        found->resize(keys.size());
+        std::vector<uint64_t> hashes(keys.size());
+        bool any = false;
+        for (size_t i = 0; i < keys.size(); i++) {
+            hashes[i] = stable_hash(keys[i]->data(), keys[i]->size());
+            (*found)[i] = may_contain(hashes[i]);
+            any = any || (*found)[i];
+        }
+        if (!any)
+            return;
+        std::lock_guard<std::mutex> g(mutex);
+        for (size_t i = 0; i < keys.size(); i++)
+            if ((*found)[i])
+                (*found)[i] = index.find(*keys[i], hashes[i], &(*values)[i]);
+    }
+
+    // Appends up to `limit` keys from [start, end) that were synced, in
+    // order; an empty `end` is no bound. Finds nothing unless the map is
+    // ordered.
+    void scan(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> *keys) const {
+        if (ordered_keys)
+            ordered_keys->scan(start, end, limit, keys);
+    }
+
+    // Lookups of missing keys the filter answered alone.
+    uint64_t filtered_count() const {
+        return filtered.load(std::memory_order_relaxed);
+    }
+
+    struct Move {
+        std::string key;
+        Value from{}, to{};
+        bool done = false;
+    };
+
+    // Repoints every key that still maps to `from` and has no pending put to
+    // `to`. Moves are applied right away and journaled like puts, so that
+    // replay orders them correctly against the puts around them; they become
+    // durable on the next sync() or sync_journal().
+    void move(std::vector<Move> &moves) {
+        std::lock_guard<std::mutex> g(mutex);
+        std::unordered_set<std::string> pending_keys;
+        for (auto &p : not_confirmed)
+            pending_keys.insert(p.first);
+        for (auto &m : moves) {
+            Value value;
+            m.done = !pending_keys.count(m.key) && index.find(m.key, &value) && value == m.from
+                && (!journaled || append_to_journal(m.key, m.to));
+            if (m.done)
+                index.put(m.key, m.to);
+        }
+    }
+
+    // Number of puts written to the journal but not yet synced.
+    size_t pending() {
         std::lock_guard<std::mutex> g(mutex);
-        auto it = _storage.find(key);
-        if (it != _storage.end())
-            return &it->second;
-        return nullptr;
+        return not_confirmed.size();
+    }
+
+    // The value of the oldest pending put, if any.
+    bool first_pending(Value *value) {
+        std::lock_guard<std::mutex> g(mutex);
+        if (not_confirmed.empty())
+            return false;
+        *value = not_confirmed.front().second;
+        return true;
+    }
+
+    // Replays an update logged by the caller of an unjournaled map: a put,
+    // or with `from` a move, which only applies if the key still maps to
+    // *from. Replaying them in the order they were made gives what move()
+    // decided, since the puts it found pending came before the move.
+    void recover(const std::string &key, const Value &value, const Value *from = nullptr) {
+        std::lock_guard<std::mutex> g(mutex);
+        Value current;
+        if (from == nullptr || (index.find(key, &current) && current == *from))
+            put_to_index(key, value);
     }
 
     void sync() {
-        if (fsync(fd) == -1)
+        sync(pending());
+    }
+
+    // Makes the first `count` pending puts durable and visible. Puts that
+    // race with the fsync stay pending until the next call. The values the
+    // applied puts replaced are appended to `superseded`.
+    void sync(size_t count, std::vector<Value> *superseded = nullptr) {
+        if (count == 0)
+            return;
+        if (journaled)
+            sync_journal();
+        std::lock_guard<std::mutex> g(mutex);
+        while (count-- && !not_confirmed.empty()) {
+            Value old_value;
+            if (put_to_index(not_confirmed.front().first, not_confirmed.front().second, &old_value)
+                    && superseded != nullptr)
+                superseded->push_back(old_value);
+            not_confirmed.pop_front();
+        }
+    }
+
+    // The journal is only appended to, so its data and size are all there is
+    // to make durable.
+    void sync_journal() {
+        std::lock_guard<std::mutex> g(checkpoint_mutex);
+        if (fdatasync(fd) == -1)
             abort();
+    }
+
+    // Bytes appended to the journal since the last checkpoint.
+    uint64_t journal_size() {
         std::lock_guard<std::mutex> g(mutex);
-        while(!not_confirmed.empty()) {
-            _storage[not_confirmed.front().first] = not_confirmed.front().second;
-            not_confirmed.pop();
+        return journal_bytes;
+    }
+
+    // Makes the index durable and starts a new journal, a header and the puts
+    // that are still pending (none if unjournaled: the caller logged them),
+    // so that the next startup replays just what was written after this call.
+    // The new journal is renamed over the old one and dup2()ed over its fd, so
+    // a crash at any point leaves a journal that replays correctly on top of
+    // the index.
+    //
+    // The map is only locked to take a snapshot of the pending puts and, after
+    // the new journal and the index are synced, to copy over what was
+    // appended to the old journal meanwhile and swap the journals. Replaying a
+    // put that the index already has changes nothing. The copied records
+    // weren't acked yet: sync_journal() waits for the checkpoint, and then
+    // makes them durable in the new journal.
+    void checkpoint() {
+        std::lock_guard<std::mutex> checkpoint_guard(checkpoint_mutex);
+        std::string pending;
+        append_journal_header(&pending);
+        off_t snapshot_end = 0;
+        typename HashIndex<Value>::SyncPoint index_sync;
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            if (journaled)
+                for (auto &p : not_confirmed)
+                    append_journal_record(&pending, p.first, p.second);
+            if (fd != -1 && (snapshot_end = lseek(fd, 0, SEEK_END)) == -1)
+                abort();
+            index_sync = index.sync_point();
         }
+
+        std::string tmp_filename = filename + ".tmp";
+        int new_fd = open(tmp_filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_APPEND, 0644);
+        if (new_fd == -1 || write(new_fd, pending.data(), pending.size()) != static_cast<ssize_t>(pending.size())
+                || fsync(new_fd) == -1)
+            abort();
+        HashIndex<Value>::sync_files(index_sync);
+
+        std::lock_guard<std::mutex> g(mutex);
+        index.mark_clean(index_sync);
+        std::string appended;
+        if (fd != -1) {
+            off_t end = lseek(fd, 0, SEEK_END);
+            if (end == -1)
+                abort();
+            appended.resize(end - snapshot_end);
+            if (pread(fd, &appended[0], appended.size(), snapshot_end) != static_cast<ssize_t>(appended.size())
+                    || write(new_fd, appended.data(), appended.size()) != static_cast<ssize_t>(appended.size()))
+                abort();
+        }
+        if (rename(tmp_filename.c_str(), filename.c_str()) == -1)
+            abort();
+
+        if (fd == -1) {
+            fd = new_fd;
+        } else {
+            if (dup2(new_fd, fd) == -1)
+                abort();
+            close(new_fd);
+        }
+        journal_bytes = pending.size() - sizeof(journal_header) + appended.size();
     }
 
 private:
-    std::unordered_map<std::string, uint64_t> _storage;
-    int fd;
-    FILE *file;
+    static constexpr uint64_t min_filter_capacity = 1024;
+
+    HashIndex<Value> index;
+    const bool journaled;
+    // only needed by load_from_disk()
+    LegacyValue legacy_value;
+    int fd = -1;
     std::string filename = "data.log";
-    std::queue<std::pair<std::string, uint64_t>> not_confirmed;
+    // guarded by mutex
+    uint64_t journal_bytes = 0;
+    std::deque<std::pair<std::string, Value>> not_confirmed;
     std::mutex mutex;
+    // held by checkpoint() throughout and by sync_journal(), which must not
+    // make the old journal durable while checkpoint() copies it
+    std::mutex checkpoint_mutex;
+    // the filter in use is the last one; the smaller ones it replaced are kept
+    // for lookups that may still be reading them, at most as much memory again
+    std::vector<std::unique_ptr<BloomFilter>> filters;
+    std::atomic<const BloomFilter *> filter{nullptr};
+    std::atomic<uint64_t> filtered{0};
+    std::unique_ptr<OrderedKeys> ordered_keys;
 
-    bool write_to_disk(const std::string &key, uint64_t value) {
-        std::string to_write = key + " " + std::to_string(value) + " ";
-        int res = fprintf(file, "%s", to_write.data());
-        if (res == to_write.size()) {
-            fflush(file);
-            std::lock_guard<std::mutex> g(mutex);
-            not_confirmed.push({key, value});
+    bool may_contain(uint64_t h) {
+        if (filter.load(std::memory_order_acquire)->may_contain(h))
+            return true;
+        filtered.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Under mutex, or before the map is shared. The key is in the filter
+    // before it is in the index, so a lookup that finds it in the index can't
+    // have been rejected.
+    bool put_to_index(const std::string &key, const Value &value, Value *old_value = nullptr) {
+        filters.back()->add(stable_hash(key.data(), key.size()));
+        bool existed = index.put(key, value, old_value);
+        if (!existed && ordered_keys)
+            ordered_keys->insert(key);
+        if (!existed && index.size() > filters.back()->capacity())
+            rebuild_filter();
+        return existed;
+    }
+
+    void load_ordered_keys() {
+        std::vector<std::string> keys;
+        keys.reserve(index.size());
+        index.for_each_key([&](std::string key) { keys.push_back(std::move(key)); });
+        std::sort(keys.begin(), keys.end());
+        ordered_keys = std::make_unique<OrderedKeys>();
+        ordered_keys->bulk_load(std::move(keys));
+    }
+
+    // Sizes a new filter for twice the keys of the index, so that it is
+    // rebuilt O(log n) times as the index grows.
+    void rebuild_filter() {
+        auto rebuilt = std::make_unique<BloomFilter>(std::max<uint64_t>(min_filter_capacity, 2 * index.size()));
+        index.for_each_hash([&](uint64_t h) { rebuilt->add(h); });
+        filter.store(rebuilt.get(), std::memory_order_release);
+        filters.push_back(std::move(rebuilt));
+    }
+
+    bool write_to_disk(const std::string &key, const Value &value) {
+        // journal order must match not_confirmed order for concurrent writers
+        std::lock_guard<std::mutex> g(mutex);
+        if (!journaled || append_to_journal(key, value)) {
+            not_confirmed.push_back({key, value});
             return true;
         }
         return false;
     }
 
+    bool append_to_journal(const std::string &key, const Value &value) {
+        std::string to_write;
+        append_journal_record(&to_write, key, value);
+        return write_journal(to_write);
+    }
+
+    bool write_journal(const std::string &records) {
+        if (write(fd, records.data(), records.size()) != static_cast<ssize_t>(records.size()))
+            return false;
+        journal_bytes += records.size();
+        return true;
+    }
+
+    // Replays the journal on top of the index, up to its first damaged record;
+    // the checkpoint then drops the torn tail together with the rest of the
+    // journal. A headerless journal that doesn't start with a valid record is
+    // a text one; if it isn't that either, it is left alone.
     void load_from_disk() {
-        std::ifstream f(filename);
+        JournalReader reader(filename);
         std::string key;
-        uint64_t value;
-        while (f >> key >> value)
-            _storage[key] = value;
-        f.close();
-        std::ofstream f_rewrite(filename);
-        for (auto &it : _storage)
-            f_rewrite << it.first << " " << it.second << " ";
-        f_rewrite.close();
+        Value value;
+        bool replayed = false;
+        while (reader.next(&key, &value)) {
+            put_to_index(key, value);
+            replayed = true;
+        }
+        if (reader.is_legacy() && !replayed && !load_text_journal()) {
+            std::cerr << filename << " is not a journal, leaving it as is" << std::endl;
+            abort();
+        }
+        legacy_value = nullptr;
+        checkpoint();
+    }
+
+    bool load_text_journal() {
+        std::vector<std::pair<std::string, uint64_t>> entries;
+        if (!read_text_journal(filename, &entries))
+            return false;
+        size_t dropped = 0;
+        for (auto &e : entries) {
+            Value value;
+            if (to_value(e.first, e.second, &value))
+                put_to_index(e.first, value);
+            else
+                dropped++;
+        }
+        std::cerr << "migrated " << entries.size() - dropped << " entries of text journal " << filename;
+        if (dropped > 0)
+            std::cerr << ", dropped " << dropped;
+        std::cerr << std::endl;
+        return true;
+    }
+
+    bool to_value(const std::string &key, uint64_t number, Value *value) {
+        if (legacy_value)
+            return legacy_value(key, number, value);
+        if constexpr (std::is_same_v<Value, uint64_t>) {
+            *value = number;
+            return true;
+        }
+        return false;
     }
 
     void on_shutdown() {
-        fclose(file);
-        std::ofstream f_rewrite(filename);
-        for (auto &it : _storage)
-            f_rewrite << it.first << " " << it.second << " ";
-        f_rewrite.close();
+        sync();
+        checkpoint();
+        close(fd);
+    }
+
+};
+
+using PersistentStorage = PersistentMap<uint64_t>;
+
+// Read-only shared mapping of a str_data_ segment. The mapping may be longer
+// than the file: the active segment is mapped ahead of the writer, and only
+// bytes that were already written are ever read.
+struct MappedSegment {
+    const char *data = nullptr;
+    uint64_t size = 0;
+
+    MappedSegment(const std::string &filename, uint64_t size) : size(size) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+            abort();
+        void *p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED)
+            abort();
+        data = static_cast<const char *>(p);
+    }
+
+    ~MappedSegment() {
+        munmap(const_cast<char *>(data), size);
     }
 
+    // Whether bytes [offset, offset + length) are in the page cache, i.e. can
+    // be read without blocking on the disk.
+    bool resident(uint64_t offset, uint64_t length) const {
+        static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+        uint64_t first = offset / page_size, last = (offset + std::max<uint64_t>(length, 1) - 1) / page_size;
+        std::vector<unsigned char> pages(last - first + 1);
+        if (mincore(const_cast<char *>(data) + first * page_size, pages.size() * page_size, pages.data()) == -1)
+            return false;
+        for (unsigned char page : pages)
+            if (!(page & 1))
+                return false;
+        return true;
+    }
 };
 
+// Where a record lives: its offset (file_id * max_size + offset in the
+// segment) and the sizes of its parts as stored, compressed values included,
+// so that the value can be sliced out of the segment without parsing the
+// record.
+struct ValueLocation {
+    uint64_t offset = 0;
+    uint32_t key_size = 0;
+    uint32_t value_size = 0;
+
+    // without the trailer of records in WAL segments, see Storage
+    uint64_t record_size() const {
+        return 2 * sizeof(uint64_t) + key_size + value_size;
+    }
+
+    // position of the value bytes inside the record
+    uint64_t value_position() const {
+        return 2 * sizeof(uint64_t) + key_size;
+    }
+
+    bool operator==(const ValueLocation &other) const {
+        return offset == other.offset && key_size == other.key_size && value_size == other.value_size;
+    }
+};
+
+static_assert(sizeof(ValueLocation) == 16, "stored as is in segment records");
+
+struct StorageOptions {
+    // byte budget of the cache of decompressed and cold-read values, 0
+    // disables it
+    uint64_t cache_size = 0;
+    // keep the keys sorted in memory for scan_keys()
+    bool ordered_index = false;
+    // store values of at least compression_min_size bytes compressed when
+    // that makes them smaller
+    bool compression = false;
+    uint64_t compression_min_size = 64;
+    // size segments are rolled at; fixed once the storage is created, since
+    // value locations encode it
+    uint64_t segment_size = 64 * 1024 * 1024;
+    // reserve each new segment's blocks up front, so that appends don't
+    // allocate them one by one
+    bool preallocate = true;
+    // append with O_DIRECT from an aligned buffer, bypassing the page cache;
+    // falls back to buffered writes where the filesystem doesn't support it
+    bool direct_io = false;
+    // keep a copy of the records of puts for take_appended_records()
+    bool replication = false;
+};
+
+// Log-structured value storage: records are appended to str_data_N segments
+// and an unjournaled PersistentMap points keys at them. The segments double as
+// the write-ahead log of that index, so a put costs one append and one
+// fdatasync: records carry a checksum, and on startup the ones written after
+// the last checkpoint are replayed into the index.
 class Storage {
 public:
-    Storage() {
+    // All files of the storage are named with the given prefix.
+    Storage(const std::string &prefix="", const StorageOptions &options={})
+        : map(prefix + "data", options.ordered_index, false, legacy_locations(prefix + "str_data_")),
+          cache(options.cache_size),
+          compression(options.compression), compression_min_size(options.compression_min_size),
+          filename(prefix + "str_data_"), config_filename(prefix + "config"), wal_filename(prefix + "wal"),
+          preallocate(options.preallocate), direct_io(options.direct_io), replication(options.replication) {
         std::cout << "Loading from disk" << std::endl;
+        load_segment_size(prefix + "segment_size", options.segment_size);
         load_from_disk();
         std::cout << "Ready" << std::endl;
     }
@@ -102,150 +528,950 @@ public:
     }
 
     void put(const std::string &key, const std::string &value) {
+        std::lock_guard<std::mutex> g(write_mutex);
         write_to_log(key, value);
     }
 
+    using KeyValue = std::pair<const std::string *, const std::string *>;
+
+    // Puts all pairs with one segment append.
+    void multi_put(const std::vector<KeyValue> &kvs) {
+        std::vector<const std::string *> keys(kvs.size());
+        std::vector<ValueLocation> locations(kvs.size());
+        for (size_t i = 0; i < kvs.size(); i++)
+            keys[i] = kvs[i].first;
+
+        std::lock_guard<std::mutex> g(write_mutex);
+        append_records(kvs.data(), kvs.size(), locations.data());
+        map.multi_put(keys, locations);
+    }
+
+    // Looks all keys up under a single index lock; values of missing keys are
+    // left untouched.
+    void multi_get(const std::vector<const std::string *> &keys, const std::vector<std::string *> &values) {
+        std::vector<ValueLocation> locations;
+        std::vector<bool> found;
+        map.multi_find(keys, &locations, &found);
+
+        std::vector<std::shared_ptr<const MappedSegment>> mapped(keys.size());
+        {
+            std::shared_lock<std::shared_mutex> g(segments_mutex);
+            for (size_t i = 0; i < keys.size(); i++) {
+                if (!found[i])
+                    continue;
+                auto it = segments.find(locations[i].offset / max_size);
+                if (it != segments.end())
+                    mapped[i] = it->second;
+            }
+        }
+
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (mapped[i])
+                read_value(*mapped[i], locations[i], values[i]);
+            else if (found[i])
+                get(*keys[i], values[i]); // compacted away in the meantime
+        }
+    }
+
     bool get(const std::string &key, std::string *value) {
-        uint64_t *offset = map.find(key);
-        if (offset == nullptr)
-            return false;
-        *value = get_from_log(*offset);
-        return true;
+        return find_value(key, value, nullptr);
     }
 
+    // Like get(), unless the value is neither cached nor in the page cache:
+    // then only sets *cold, leaving the read to a get_cold() on a thread that
+    // may block on the disk.
+    bool get_if_resident(const std::string &key, std::string *value, bool *cold) {
+        *cold = false;
+        return find_value(key, value, cold);
+    }
+
+    // get() for a key get_if_resident() found cold, without looking its value
+    // up in the cache again.
+    bool get_cold(const std::string &key, std::string *value) {
+        bool cold = true;
+        return find_value(key, value, &cold);
+    }
+
+    // Keys from [start, end) in order, see PersistentMap::scan(); their values
+    // are read with get().
+    void scan_keys(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> *keys) {
+        map.scan(start, end, limit, keys);
+    }
+
+    // Makes every put that returned before the call durable and visible with
+    // a single fdatasync of the active segment: its records are what the index
+    // is recovered from, the index itself is only made durable by checkpoints.
+    // Callers must not sync concurrently: a put one of them applies might not
+    // be covered by its fdatasync.
     void sync() {
-        map.sync();
+        size_t count = map.pending();
+        if (count == 0)
+            return;
+        sync_segment();
+        std::vector<ValueLocation> superseded;
+        map.sync(count, &superseded);
+        for (auto &location : superseded) {
+            mark_dead(location);
+            cache.erase(location.offset);
+        }
+    }
+
+    // With options.replication: moves the records of the puts appended since
+    // the last call to the end of `records`, byte for byte as the segments
+    // hold them. They are written by then, so the next sync() makes them
+    // durable.
+    void take_appended_records(std::string *records) {
+        std::lock_guard<std::mutex> g(write_mutex);
+        records->append(replication_buffer);
+        replication_buffer.clear();
+    }
+
+    // Calls f(key, value) for every record in data[0, size), as handed out by
+    // take_appended_records(), with values decompressed. False if the data
+    // isn't made of whole, intact records.
+    template <typename F>
+    static bool for_each_record(const char *data, size_t size, F f) {
+        RecordHeader record;
+        std::string key, value;
+        for (size_t offset = 0; offset < size; offset += record.size) {
+            if (!parse_record(data + offset, size - offset, true, &record) || record.copied)
+                return false;
+            read_record(data + offset, record, &key, &value);
+            f(key, value);
+        }
+        return true;
+    }
+
+    const ValueCache &value_cache() const {
+        return cache;
+    }
+
+    struct Usage {
+        uint64_t segments = 0;
+        uint64_t total_bytes = 0;
+        uint64_t dead_bytes = 0;
+        // bytes written to segments since startup, compaction copies included
+        uint64_t appended_bytes = 0;
+        // lookups of missing keys rejected by the index filter
+        uint64_t filtered_lookups = 0;
+        // bytes compression kept out of the appended ones
+        uint64_t compression_saved_bytes = 0;
+    };
+
+    Usage usage() {
+        Usage u;
         std::lock_guard<std::mutex> g(mutex);
-        if (fsync(fd) == -1)
-            abort();
+        for (auto &it : stats) {
+            ++u.segments;
+            u.total_bytes += it.second.total;
+            u.dead_bytes += it.second.dead;
+        }
+        u.appended_bytes = appended_bytes.load(std::memory_order_relaxed);
+        u.filtered_lookups = map.filtered_count();
+        u.compression_saved_bytes = compression_saved_bytes.load(std::memory_order_relaxed);
+        return u;
     }
 
+    // One step of online compaction: copies up to `budget` bytes worth of
+    // records out of the sealed segment with the largest share of dead bytes
+    // (at least `min_dead_percent`), keeping only records the index still
+    // points to, and deletes the segment once it is fully copied. A record
+    // whose move was skipped because its key had a pending put is tried again
+    // on the next step, and the segment stays until the index no longer
+    // points to any of them. Returns the number of bytes scanned, 0 if no
+    // segment qualifies.
+    uint64_t compact(uint64_t budget, uint64_t min_dead_percent) {
+        if (compaction_file_id == -1 && !pick_compaction_segment(min_dead_percent))
+            return 0;
+
+        std::shared_ptr<const MappedSegment> segment;
+        uint64_t end;
+        {
+            std::shared_lock<std::shared_mutex> g(segments_mutex);
+            segment = segments.at(compaction_file_id);
+        }
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            end = stats.at(compaction_file_id).total;
+        }
+
+        std::vector<PersistentMap<ValueLocation>::Move> moves;
+        uint64_t scanned = 0;
+        const bool checked = static_cast<uint64_t>(compaction_file_id) >= wal_file_id;
+        {
+            std::lock_guard<std::mutex> g(write_mutex);
+            for (auto &from : compaction_retries) {
+                RecordHeader record;
+                const char *p = segment->data + from.offset % max_size;
+                parse_record(p, end - from.offset % max_size, checked, &record);
+                std::string key, value;
+                read_record(p, record, &key, nullptr);
+                ValueLocation saved;
+                // the pending put may have been synced since
+                if (map.find(key, &saved) && saved == from) {
+                    read_record(p, record, nullptr, &value);
+                    ValueLocation to = append_record(key, value, &from);
+                    moves.push_back({std::move(key), from, to});
+                }
+                scanned += record.size;
+            }
+            compaction_retries.clear();
+            while (compaction_offset < end && scanned < budget) {
+                RecordHeader record;
+                const char *p = segment->data + compaction_offset;
+                if (!parse_record(p, end - compaction_offset, checked, &record)) {
+                    // torn tail left by a crash
+                    compaction_offset = end;
+                    break;
+                }
+                std::string key, value;
+                read_record(p, record, &key, nullptr);
+                ValueLocation from = record.location(compaction_file_id * max_size + compaction_offset), saved;
+                if (map.find(key, &saved) && saved == from) {
+                    read_record(p, record, nullptr, &value);
+                    ValueLocation to = append_record(key, value, &from);
+                    moves.push_back({std::move(key), from, to});
+                }
+                compaction_offset += record.size;
+                scanned += record.size;
+            }
+        }
+
+        if (!moves.empty()) {
+            // the copies must be durable before the index points to them, and
+            // before the segment is deleted, since they also log the moves
+            sync_segment();
+            map.move(moves);
+            for (auto &m : moves) {
+                // the key was overwritten while its record was being copied,
+                // or has a put pending that may still be dropped
+                if (!m.done) {
+                    mark_dead(m.to);
+                    compaction_retries.push_back(m.from);
+                } else {
+                    cache.erase(m.from.offset);
+                }
+            }
+        }
+
+        if (compaction_offset >= end && compaction_retries.empty()) {
+            {
+                std::unique_lock<std::shared_mutex> g(segments_mutex);
+                segments.erase(compaction_file_id);
+            }
+            int last_file_id;
+            {
+                std::lock_guard<std::mutex> g(mutex);
+                stats.erase(compaction_file_id);
+                last_file_id = next_file_id - 1;
+            }
+            std::remove((filename + std::to_string(compaction_file_id)).c_str());
+            advance_first_file_id(last_file_id);
+            compaction_file_id = -1;
+            save_config();
+        }
+        return scanned;
+    }
+
+    // Makes the index durable once `min_journal_size` bytes were appended
+    // since the last checkpoint, which bounds what a restart replays, along
+    // with the segment stats, which are otherwise only saved on segment rolls
+    // and compactions. Stats updates made after the last save are lost on a
+    // crash, which only delays compaction. Must not run concurrently with
+    // compact().
+    void checkpoint(uint64_t min_journal_size) {
+        if (appended_bytes.load(std::memory_order_relaxed) - checkpoint_appended < min_journal_size)
+            return;
+        write_checkpoint();
+        save_config();
+    }
 
 private:
-    PersistentStorage map;
-    FILE *file = nullptr;
-    int fd;
+    // set in the value size field of a record whose value is stored
+    // compressed: the value bytes are then its u32 size and the lz_compress()
+    // output
+    static constexpr uint64_t compressed_flag = 1ULL << 63;
+    // set in the key size field of a record copied by compaction: its
+    // trailer then starts with the ValueLocation it was copied from
+    static constexpr uint64_t copied_flag = 1ULL << 63;
+
+    PersistentMap<ValueLocation> map;
+    ValueCache cache;
+    const bool compression;
+    const uint64_t compression_min_size;
+    // the active segment, appended to with pwrite at `tail`
+    int fd = -1;
+    // segments before first_file_id are all deleted; it only moves in
+    // compact() and on startup
     int first_file_id = 0, next_file_id = 0;
     std::string filename = "str_data_";
     std::string config_filename = "config";
+    // "wal_file_id checkpoint_position": segments from wal_file_id on have
+    // checksummed records (older ones were written when the index had a
+    // journal of its own), and the index covers every record before the
+    // location offset checkpoint_position; both are owned by the checkpointing
+    // thread
+    std::string wal_filename = "wal";
+    uint64_t wal_file_id = 0;
+    uint64_t checkpoint_position = 0;
+    uint64_t checkpoint_appended = 0;
     uint64_t max_size = 1024 * 1024 * 64;
+    const bool preallocate;
+    bool direct_io;
+    const bool replication;
+    // direct_io: the bytes of the active segment's last, partial block, which
+    // the next flush writes again followed by the new records
+    static constexpr uint64_t direct_io_alignment = 4096;
+    std::unique_ptr<char, decltype(&free)> direct_buffer{nullptr, &free};
+    uint64_t direct_buffer_size = 0;
+    std::string direct_tail;
+    // serializes writers; the active segment, write_buffer and
+    // replication_buffer belong to it
+    std::mutex write_mutex;
+    std::string write_buffer;
+    std::string replication_buffer;
+    std::string compress_buffer;
+    // end of the active segment: only the writer moves it, readers never need
+    // it since they only follow locations handed out by the index
+    std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> appended_bytes{0};
+    std::atomic<uint64_t> compression_saved_bytes{0};
+    // guards stats; fd and next_file_id change under both locks, so that
+    // fsyncs from other threads never see a closed fd
     std::mutex mutex;
+    // serializes config rewrites: writers save it on segment rolls, the
+    // checkpointing thread on checkpoints
+    std::mutex config_mutex;
+    // file_id -> mapping; readers only take it shared, so GETs don't wait for
+    // each other and only wait for the writer when it maps a segment
+    std::shared_mutex segments_mutex;
+    std::map<uint64_t, std::shared_ptr<const MappedSegment>> segments;
 
+    struct SegmentStats {
+        uint64_t total = 0;
+        uint64_t dead = 0;
+    };
+    // file_id -> bytes written / bytes no longer referenced by the index,
+    // guarded by mutex
+    std::map<uint64_t, SegmentStats> stats;
+    // the segment being compacted, owned by the compact() caller
+    int64_t compaction_file_id = -1;
+    uint64_t compaction_offset = 0;
+    // records of that segment whose moves were skipped
+    std::vector<ValueLocation> compaction_retries;
+
+    // Only the records after the last checkpoint are scanned: the index
+    // already points into the segments, they only have to be mapped again.
+    // Writing resumes in a new segment, the previous one may end with a torn
+    // record, which the checkpoint taken right away leaves behind for good.
     void load_from_disk() {
         load_config();
+        load_wal_state();
+        for (int i = first_file_id; i < next_file_id; i++) {
+            std::string segment_filename = filename + std::to_string(i);
+            struct stat st;
+            if (stat(segment_filename.c_str(), &st) == -1 || st.st_size == 0) {
+                // compacted away while running, or never written to
+                std::remove(segment_filename.c_str());
+                stats.erase(i);
+                continue;
+            }
+            segments[i] = std::make_shared<const MappedSegment>(segment_filename, st.st_size);
+            stats[i].total = st.st_size;
+        }
+        advance_first_file_id(next_file_id - 1);
+        recover_index();
         open_new_file();
-        int first_new_file_id = next_file_id;
-        for (int i = first_file_id; i < first_new_file_id; i++) {
-            FILE *f = fopen((filename + std::to_string(i)).c_str(), "r");
-            int offset = 0;
-            std::string key, value;
-            while (true) {
-                int cur_offset = 0;
-                auto p = get_key_value(f);
-                if (p.first.empty())
-                    break;
-                std::tie(key, value) = p;
+        write_checkpoint();
+    }
 
-                cur_offset += 2 * sizeof(uint64_t) + key.size() + value.size();
-                uint64_t *saved_offset = map.find(key);
-                if (saved_offset == nullptr) {
-                    continue;
-                }
-                if (*saved_offset == i * max_size + offset) {
-                    write_to_log(key, value);
-                }
-                offset += cur_offset;
-                if (offset >= max_size)
-                    break;
+    // Moves first_file_id past the deleted segments before `last_file_id`,
+    // which exists or is being mapped, so that restarts don't look for every
+    // segment that ever existed. The next save_config() persists it.
+    void advance_first_file_id(int last_file_id) {
+        int first = first_file_id;
+        {
+            std::shared_lock<std::shared_mutex> g(segments_mutex);
+            while (first < last_file_id && !segments.count(first))
+                first++;
+        }
+        std::lock_guard<std::mutex> g(mutex);
+        first_file_id = first;
+    }
+
+    // Points the entries of a text journal, from before locations had sizes,
+    // at the records they name in the 64 MiB segments of those days. Entries
+    // that don't name a record of their key, like the numbers the journal was
+    // once shared with, are dropped.
+    static PersistentMap<ValueLocation>::LegacyValue legacy_locations(const std::string &filename) {
+        const uint64_t legacy_segment_size = 64 * 1024 * 1024;
+        auto segments = std::make_shared<std::map<uint64_t, std::unique_ptr<MappedSegment>>>();
+        return [filename, segments](const std::string &key, uint64_t offset, ValueLocation *location) {
+            uint64_t file_id = offset / legacy_segment_size, position = offset % legacy_segment_size;
+            auto &segment = (*segments)[file_id];
+            if (!segment) {
+                std::string segment_filename = filename + std::to_string(file_id);
+                struct stat st;
+                if (stat(segment_filename.c_str(), &st) == -1 || st.st_size == 0)
+                    return false;
+                segment = std::make_unique<MappedSegment>(segment_filename, st.st_size);
             }
-            fclose(f);
-            if (i + 1 < first_new_file_id) {
-                std::remove((filename + std::to_string(i)).c_str());
+            RecordHeader record;
+            const char *p = segment->data + position;
+            if (position >= segment->size || !parse_record(p, segment->size - position, false, &record)
+                    || record.key_size != key.size() || memcmp(p + sizeof(uint64_t), key.data(), key.size()) != 0)
+                return false;
+            *location = record.location(offset);
+            return true;
+        };
+    }
+
+    // Replays the records from checkpoint_position on into the index: puts,
+    // and compaction copies as the moves they were made for. Segments are
+    // replayed in order, each up to its first torn record.
+    void recover_index() {
+        uint64_t recovered = 0;
+        for (auto &it : segments) {
+            uint64_t file_id = it.first;
+            if (file_id < wal_file_id || file_id < checkpoint_position / max_size)
+                continue;
+            uint64_t offset = file_id == checkpoint_position / max_size ? checkpoint_position % max_size : 0;
+            uint64_t end = stats[file_id].total;
+            RecordHeader record;
+            for (; offset < end && parse_record(it.second->data + offset, end - offset, true, &record);
+                    offset += record.size) {
+                std::string key;
+                read_record(it.second->data + offset, record, &key, nullptr);
+                map.recover(key, record.location(file_id * max_size + offset),
+                            record.copied ? &record.copied_from : nullptr);
+                recovered++;
             }
         }
-        first_file_id = first_new_file_id - 1;
-        save_config();
+        if (recovered > 0)
+            std::cout << "Recovered " << recovered << " index updates from the segments" << std::endl;
+    }
+
+    // Makes the index durable up to the oldest put it doesn't hold yet and
+    // records that position. A put applied between the two is replayed again
+    // after a crash, which changes nothing; compaction leaves the segments
+    // from the position on alone, so what the replay reads stays there.
+    void write_checkpoint() {
+        uint64_t position;
+        {
+            std::lock_guard<std::mutex> g(write_mutex);
+            ValueLocation first;
+            if (map.first_pending(&first))
+                position = first.offset;
+            else
+                position = (next_file_id - 1) * max_size + tail.load(std::memory_order_relaxed);
+            checkpoint_appended = appended_bytes.load(std::memory_order_relaxed);
+        }
+        map.checkpoint();
+        checkpoint_position = position;
+        replace_file(wal_filename, std::to_string(wal_file_id) + " " + std::to_string(checkpoint_position) + "\n");
+    }
+
+    // A storage from before the segments were the log starts it with the
+    // segment opened next; its index journal was replayed by the map.
+    void load_wal_state() {
+        std::ifstream f(wal_filename);
+        if (f >> wal_file_id >> checkpoint_position)
+            return;
+        wal_file_id = next_file_id;
+        checkpoint_position = next_file_id * max_size;
     }
 
     void write_to_log(const std::string &key, const std::string &value) {
-        uint64_t key_size = key.size();
-        uint64_t value_size = value.size();
-        uint64_t offset = ftell(file);
-        if (offset >= max_size) {
-            open_new_file();
-            offset = 0;
+        map.put(key, append_record(key, value));
+    }
+
+    // Appends a record to the active segment and returns its location; must
+    // be called with write_mutex held.
+    ValueLocation append_record(const std::string &key, const std::string &value,
+                                const ValueLocation *copied_from = nullptr) {
+        KeyValue kv(&key, &value);
+        ValueLocation location;
+        append_records(&kv, 1, &location, copied_from);
+        return location;
+    }
+
+    // Appends the records with a single write per segment they land in and
+    // fills in their locations; must be called with write_mutex held. A record
+    // is key size (u64), key, value size (u64), value and the trailer: for a
+    // compaction copy the location it was copied from (`copied_from`, one per
+    // record), then the CRC32C of the record up to there (u32).
+    void append_records(const KeyValue *kvs, size_t count, ValueLocation *locations,
+                        const ValueLocation *copied_from = nullptr) {
+        uint64_t offset = tail.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; i++) {
+            if (offset >= max_size) {
+                flush_records(offset);
+                open_new_file();
+                offset = 0;
+            }
+            const std::string &key = *kvs[i].first;
+            const std::string &value = encode_value(*kvs[i].second);
+            uint64_t key_size = key.size();
+            uint64_t value_size = value.size();
+            uint64_t key_field = key_size | (copied_from != nullptr ? copied_flag : 0);
+            uint64_t value_field = value_size | (&value == &compress_buffer ? compressed_flag : 0);
+            locations[i].offset = (next_file_id - 1) * max_size + offset;
+            locations[i].key_size = key_size;
+            locations[i].value_size = value_size;
+
+            size_t start = write_buffer.size();
+            write_buffer.append(reinterpret_cast<const char *>(&key_field), sizeof(uint64_t));
+            write_buffer.append(key);
+            write_buffer.append(reinterpret_cast<const char *>(&value_field), sizeof(uint64_t));
+            write_buffer.append(value);
+            if (copied_from != nullptr)
+                write_buffer.append(reinterpret_cast<const char *>(&copied_from[i]), sizeof(ValueLocation));
+            uint32_t crc = crc32c(0, write_buffer.data() + start, write_buffer.size() - start);
+            write_buffer.append(reinterpret_cast<const char *>(&crc), sizeof(crc));
+            offset += write_buffer.size() - start;
+            // compaction copies only matter to this storage
+            if (replication && copied_from == nullptr)
+                replication_buffer.append(write_buffer, start, std::string::npos);
         }
+        flush_records(offset);
+    }
 
-        fwrite(&key_size, sizeof(uint64_t), 1, file);
-        fwrite(key.c_str(), sizeof(char), key_size, file);
-        fwrite(&value_size, sizeof(uint64_t), 1, file);
-        fwrite(value.c_str(), sizeof(char), value_size, file);
-        fflush(file);
-//        std::cout << next_file_id - 1 << ", " << max_size << ", " << offset << std::endl;
-        map.put(key, (next_file_id - 1) * max_size + offset);
+    // The bytes to store for `value`: either the value itself or its
+    // compressed form in compress_buffer.
+    const std::string &encode_value(const std::string &value) {
+        if (!compression || value.size() < compression_min_size || value.size() > UINT32_MAX)
+            return value;
+        uint32_t size = value.size();
+        compress_buffer.assign(reinterpret_cast<const char *>(&size), sizeof(size));
+        lz_compress(value.data(), value.size(), &compress_buffer);
+        if (compress_buffer.size() >= value.size())
+            return value;
+        compression_saved_bytes.fetch_add(value.size() - compress_buffer.size(), std::memory_order_relaxed);
+        return compress_buffer;
     }
 
-    void open_new_file() {
-        if (file != nullptr)
-            fclose(file);
-        file = fopen((filename + std::to_string(next_file_id++)).c_str(), "w+b");
+    // Decodes stored value bytes whose size field is `value_field`.
+    static void decode_value(const char *p, uint64_t value_field, std::string *value) {
+        uint64_t size = value_field & ~compressed_flag;
+        if (!(value_field & compressed_flag)) {
+            value->assign(p, size);
+            return;
+        }
+        uint32_t raw_size;
+        if (size < sizeof(raw_size))
+            abort();
+        memcpy(&raw_size, p, sizeof(raw_size));
+        value->resize(raw_size);
+        if (!lz_decompress(p + sizeof(raw_size), size - sizeof(raw_size), value->data(), raw_size))
+            abort();
+    }
+
+    // Writes out write_buffer; the active segment ends at `end` afterwards.
+    void flush_records(uint64_t end) {
+        if (write_buffer.empty())
+            return;
+        if (end > active_segment()->size)
+            map_segment(next_file_id - 1, end);
+
+        uint64_t start = end - write_buffer.size();
+        if (direct_io)
+            write_direct(start, end);
+        else
+            write_fully(write_buffer.data(), write_buffer.size(), start);
+        appended_bytes.fetch_add(write_buffer.size(), std::memory_order_relaxed);
+        write_buffer.clear();
+        tail.store(end, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            stats[next_file_id - 1].total = end;
+        }
+    }
+
+    void write_fully(const char *data, uint64_t size, uint64_t position) {
+        for (uint64_t written = 0; written < size;) {
+            ssize_t res = pwrite(fd, data + written, size - written, position + written);
+            if (res == -1 && errno == EINTR)
+                continue;
+            if (res <= 0)
+                abort();
+            written += res;
+        }
+    }
+
+    // Writes write_buffer, which goes at [start, end), as whole aligned
+    // blocks: the partial block it starts in comes from direct_tail, the one
+    // it ends in is padded with zeros that the next flush overwrites. So the
+    // file may end up to a block past `end` until the segment is sealed.
+    void write_direct(uint64_t start, uint64_t end) {
+        uint64_t aligned_start = start / direct_io_alignment * direct_io_alignment;
+        uint64_t aligned_end = (end + direct_io_alignment - 1) / direct_io_alignment * direct_io_alignment;
+        uint64_t size = aligned_end - aligned_start;
+        if (direct_tail.size() != start - aligned_start)
+            abort();
+        if (size > direct_buffer_size) {
+            void *p = nullptr;
+            if (posix_memalign(&p, direct_io_alignment, size) != 0)
+                abort();
+            direct_buffer.reset(static_cast<char *>(p));
+            direct_buffer_size = size;
+        }
+        char *buffer = direct_buffer.get();
+        memcpy(buffer, direct_tail.data(), direct_tail.size());
+        memcpy(buffer + direct_tail.size(), write_buffer.data(), write_buffer.size());
+        memset(buffer + (end - aligned_start), 0, aligned_end - end);
+        write_fully(buffer, size, aligned_start);
+
+        uint64_t tail_start = end / direct_io_alignment * direct_io_alignment;
+        direct_tail.assign(buffer + (tail_start - aligned_start), end - tail_start);
+    }
+
+    // Data only: the segment is preallocated or only grows, and a size the
+    // file doesn't reach yet is part of what fdatasync() makes durable anyway.
+    void sync_segment() {
         std::lock_guard<std::mutex> g(mutex);
-        fd = fileno(file);
+        if (fdatasync(fd) == -1)
+            abort();
+    }
+
+    // Drops the preallocated blocks and the direct_io padding past the end of
+    // the active segment before it is sealed, so that its size is exact.
+    void trim_segment() {
+        if ((preallocate || direct_io) && ftruncate(fd, tail.load(std::memory_order_relaxed)) == -1)
+            abort();
+    }
+
+    // Doesn't touch the segment itself: old segments stay out of memory.
+    void mark_dead(const ValueLocation &location) {
+        std::lock_guard<std::mutex> g(mutex);
+        auto it = stats.find(location.offset / max_size);
+        if (it != stats.end())
+            it->second.dead += location.record_size();
+    }
+
+    bool pick_compaction_segment(uint64_t min_dead_percent) {
+        std::lock_guard<std::mutex> g(mutex);
+        uint64_t best_dead = 0, best_total = 1;
+        for (auto &it : stats) {
+            const auto &st = it.second;
+            // records from the checkpoint on may still have to be replayed
+            if (it.first + 1 == static_cast<uint64_t>(next_file_id) || it.first >= checkpoint_position / max_size
+                    || st.total == 0 || st.dead * 100 < st.total * min_dead_percent)
+                continue;
+            if (st.dead * best_total > best_dead * st.total) {
+                compaction_file_id = it.first;
+                best_dead = st.dead;
+                best_total = st.total;
+            }
+        }
+        compaction_offset = 0;
+        return compaction_file_id != -1;
+    }
+
+    void open_new_file() {
+        {
+            // the sealed segment may still hold records a pending sync covers
+            std::lock_guard<std::mutex> g(mutex);
+            if (fd != -1) {
+                trim_segment();
+                if (fdatasync(fd) == -1)
+                    abort();
+                close(fd);
+            }
+            std::string segment_filename = filename + std::to_string(next_file_id++);
+            fd = open(segment_filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | (direct_io ? O_DIRECT : 0), 0644);
+            if (fd == -1 && direct_io && errno == EINVAL) {
+                std::cerr << "O_DIRECT unsupported, using buffered writes" << std::endl;
+                direct_io = false;
+                fd = open(segment_filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            }
+            if (fd == -1)
+                abort();
+            // only an optimization: appends allocate whatever this didn't
+            if (preallocate)
+                fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, max_size);
+            direct_tail.clear();
+            tail.store(0, std::memory_order_release);
+        }
+        map_segment(next_file_id - 1, 0);
         save_config();
     }
 
-    std::string get_from_log(uint64_t offset) {
-        uint64_t file_id = offset / max_size;
-        uint64_t file_offset = offset % max_size;
-        FILE *f = file;
-        if (file_id + 1 != next_file_id)
-            f = fopen((filename + std::to_string(file_id)).c_str(), "r");
-        fseek(f, file_offset, SEEK_SET);
-        std::string key, value;
-        std::tie(key, value) = get_key_value(f);
-        fseek(f, 0, SEEK_END);
-        if (file_id + 1 != next_file_id)
-            fclose(f);
-        return value;
+    // Maps the segment ahead of the writer: for at least 2 * max_size bytes,
+    // so that it is remapped only for records larger than max_size.
+    void map_segment(uint64_t file_id, uint64_t min_size) {
+        auto segment = std::make_shared<const MappedSegment>(
+            filename + std::to_string(file_id), std::max(2 * max_size, 2 * min_size));
+        std::unique_lock<std::shared_mutex> g(segments_mutex);
+        segments[file_id] = std::move(segment);
+    }
+
+    std::shared_ptr<const MappedSegment> active_segment() {
+        std::shared_lock<std::shared_mutex> g(segments_mutex);
+        return segments.at(next_file_id - 1);
+    }
+
+    // A lookup only misses the segment of the location it found when the
+    // record was just copied out of it, and compaction doesn't delete a
+    // segment the index still points into, so a few attempts are plenty.
+    static constexpr int max_read_attempts = 8;
+
+    // get_from_log() of the key's location, looked up again while its segment
+    // turns out to be compacted away.
+    bool find_value(const std::string &key, std::string *value, bool *cold) {
+        ValueLocation location;
+        for (int attempt = 0; attempt < max_read_attempts; attempt++) {
+            if (!map.find(key, &location))
+                return false;
+            if (get_from_log(location, value, cold))
+                return true;
+        }
+        std::cerr << "key " << key << " points into deleted segment " << location.offset / max_size << std::endl;
+        return false;
+    }
+
+    // With `cold` set reads past the cache; with `cold` clear only reads a
+    // resident value and sets `cold` otherwise.
+    bool get_from_log(const ValueLocation &location, std::string *value, bool *cold = nullptr) {
+        uint64_t file_id = location.offset / max_size;
+        std::shared_ptr<const MappedSegment> segment;
+        {
+            std::shared_lock<std::shared_mutex> g(segments_mutex);
+            auto it = segments.find(file_id);
+            if (it == segments.end())
+                return false;
+            segment = it->second;
+        }
+        if (cold == nullptr) {
+            read_value(*segment, location, value);
+        } else if (*cold) {
+            // read from the disk, which a repeat would wait for again
+            copy_value(*segment, location, value);
+            cache.insert(location.offset, *value);
+        } else if (!cache.find(location.offset, value)) {
+            // the size field before the value too: it tells whether to decompress
+            if (!segment->resident(location.offset % max_size + location.value_position() - sizeof(uint64_t),
+                                   location.value_size + sizeof(uint64_t)))
+                *cold = true;
+            else if (copy_value(*segment, location, value))
+                cache.insert(location.offset, *value);
+        }
+        return true;
     }
 
-    std::pair<std::string , std::string> get_key_value(FILE *f) {
-        size_t read_bytes;
-        uint64_t key_size;
-        read_bytes = fread(&key_size, sizeof(uint64_t), 1, f);
-        if (read_bytes == 0)
-            return std::make_pair(std::string(), std::string());
+    // Copies the value out of the segment unless it is cached. Only values
+    // that had to be decompressed are cached: copying any other value out of
+    // the mapping is cheaper than a cache hit.
+    void read_value(const MappedSegment &segment, const ValueLocation &location, std::string *value) {
+        if (cache.find(location.offset, value))
+            return;
+        if (copy_value(segment, location, value))
+            cache.insert(location.offset, *value);
+    }
 
-        std::string key(key_size, 0);
-        fread(&key[0], sizeof(char), key_size, f);
-        uint64_t value_size;
-        fread(&value_size, sizeof(uint64_t), 1, f);
-        std::string value(value_size, 0);
-        fread(&value[0], sizeof(char), value_size, f);
-        return std::make_pair(key, value);
+    // Decodes the value out of the segment; true if it was stored compressed.
+    bool copy_value(const MappedSegment &segment, const ValueLocation &location, std::string *value) {
+        const char *p = segment.data + location.offset % max_size + location.value_position();
+        uint64_t value_field;
+        memcpy(&value_field, p - sizeof(uint64_t), sizeof(uint64_t));
+        decode_value(p, value_field, value);
+        return value_field & compressed_flag;
     }
 
+    // The fields of a record, see append_records(); `size` includes the
+    // trailer.
+    struct RecordHeader {
+        uint64_t key_size = 0;
+        uint64_t value_field = 0;
+        uint64_t size = 0;
+        bool copied = false;
+        ValueLocation copied_from;
+
+        ValueLocation location(uint64_t offset) const {
+            ValueLocation location;
+            location.offset = offset;
+            location.key_size = key_size;
+            location.value_size = value_field & ~compressed_flag;
+            return location;
+        }
+    };
+
+    // Whether a whole record starts at `p`, within `left` bytes, with a
+    // matching checksum if `checked`; segments older than wal_file_id have no
+    // trailers. A record that doesn't parse is the torn tail left by a crash.
+    static bool parse_record(const char *p, uint64_t left, bool checked, RecordHeader *record) {
+        uint64_t key_field;
+        if (left < 2 * sizeof(uint64_t))
+            return false;
+        memcpy(&key_field, p, sizeof(uint64_t));
+        record->key_size = key_field & ~copied_flag;
+        record->copied = checked && (key_field & copied_flag);
+        if (record->key_size > left - 2 * sizeof(uint64_t))
+            return false;
+        memcpy(&record->value_field, p + sizeof(uint64_t) + record->key_size, sizeof(uint64_t));
+        uint64_t value_size = record->value_field & ~compressed_flag;
+        if (value_size > left - 2 * sizeof(uint64_t) - record->key_size)
+            return false;
+        record->size = 2 * sizeof(uint64_t) + record->key_size + value_size;
+        if (!checked)
+            return true;
+
+        uint64_t checksummed = record->size + (record->copied ? sizeof(ValueLocation) : 0);
+        uint32_t crc;
+        if (checksummed + sizeof(crc) > left)
+            return false;
+        if (record->copied)
+            memcpy(&record->copied_from, p + record->size, sizeof(ValueLocation));
+        memcpy(&crc, p + checksummed, sizeof(crc));
+        record->size = checksummed + sizeof(crc);
+        return crc32c(0, p, checksummed) == crc;
+    }
+
+    // Copies out the parts of a parsed record that are asked for, the value
+    // decompressed.
+    static void read_record(const char *p, const RecordHeader &record, std::string *key, std::string *value) {
+        p += sizeof(uint64_t);
+        if (key != nullptr)
+            key->assign(p, record.key_size);
+        if (value != nullptr)
+            decode_value(p + record.key_size + sizeof(uint64_t), record.value_field, value);
+    }
+
+    // The config holds the range of segment ids followed by a
+    // "file_id total dead" line per segment.
     void load_config() {
         std::ifstream f(config_filename);
         if (!(f >> first_file_id) || !(f >> next_file_id)) {
             f.close();
             first_file_id = next_file_id = 0;
             save_config();
+            return;
         }
+        uint64_t file_id;
+        SegmentStats st;
+        while (f >> file_id >> st.total >> st.dead)
+            stats[file_id] = st;
     }
 
+    // Replaces the config atomically: it is the only record of which
+    // segments exist.
     void save_config() {
-        std::ofstream f(config_filename);
-        f << first_file_id << "\n" << next_file_id << "\n";
+        std::lock_guard<std::mutex> config_guard(config_mutex);
+        std::string to_write;
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            to_write = std::to_string(first_file_id) + "\n" + std::to_string(next_file_id) + "\n";
+            for (auto &it : stats)
+                to_write += std::to_string(it.first) + " " + std::to_string(it.second.total)
+                    + " " + std::to_string(it.second.dead) + "\n";
+        }
+        replace_file(config_filename, to_write);
+    }
+
+    static void replace_file(const std::string &name, const std::string &contents) {
+        std::string tmp_filename = name + ".tmp";
+        FILE *f = fopen(tmp_filename.c_str(), "w");
+        if (f == nullptr || fwrite(contents.data(), 1, contents.size(), f) != contents.size()
+                || fflush(f) != 0 || fsync(fileno(f)) == -1)
+            abort();
+        fclose(f);
+        if (rename(tmp_filename.c_str(), name.c_str()) == -1)
+            abort();
     }
 
+    // Checkpoints at the end of the log, so the next startup replays nothing.
     void on_shutdown() {
-        std::lock_guard<std::mutex> g(mutex);
-        if (fsync(fd) == -1)
+        sync();
+        write_checkpoint();
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            trim_segment();
+            if (fdatasync(fd) == -1)
+                abort();
+            close(fd);
+        }
+        save_config();
+    }
+
+    // The segment size the storage was created with wins over the requested
+    // one. Storages from before it was recorded used the 64 MiB default.
+    void load_segment_size(const std::string &segment_size_filename, uint64_t requested) {
+        std::ifstream f(segment_size_filename);
+        if (f >> max_size) {
+            if (max_size != requested)
+                std::cerr << "storage has " << max_size << " byte segments, " << requested << " requested" << std::endl;
+            return;
+        }
+        f.close();
+        if (!std::ifstream(config_filename))
+            max_size = requested;
+        if (max_size == 0)
             abort();
-        fclose(file);
+        std::ofstream(segment_size_filename) << max_size << "\n";
+    }
+
+};
+
+// Hash-partitions keys over independent storages, each with its own files and
+// locks. Shard i of a storage named `name` is T(prefix_i + name); a single
+// shard uses the unprefixed name; any further arguments are passed to every
+// shard. The shard count is recorded on disk since changing it would move keys
+// to other shards.
+template <typename T>
+class Sharded {
+public:
+    template <typename... Args>
+    Sharded(size_t count, const std::string &name="", const Args &...args) {
+        check_shard_count(count);
+        for (size_t i = 0; i < count; i++) {
+            std::string prefix = count == 1 ? "" : "shard" + std::to_string(i) + "_";
+            shards.emplace_back(std::make_unique<T>(prefix + name, args...));
+        }
     }
 
+    template <typename F>
+    void for_each(F f) {
+        for (auto &shard : shards)
+            f(*shard);
+    }
+
+    T &shard(const std::string &key) {
+        return *shards[shard_index(key)];
+    }
+
+    size_t shard_index(const std::string &key) const {
+        // high bits: the low ones pick the bucket inside the shard's index
+        return (stable_hash(key.data(), key.size()) >> 32) % shards.size();
+    }
+
+    T &at(size_t i) {
+        return *shards[i];
+    }
+
+    size_t size() const {
+        return shards.size();
+    }
+
+    void sync() {
+        for (auto &shard : shards)
+            shard->sync();
+    }
+
+private:
+    std::vector<std::unique_ptr<T>> shards;
+
+    static void check_shard_count(size_t count) {
+        std::string shards_filename = "shards";
+        std::ifstream f(shards_filename);
+        size_t saved;
+        if (f >> saved) {
+            if (saved != count) {
+                std::cerr << "storage has " << saved << " shards, " << count << " requested" << std::endl;
+                abort();
+            }
+            return;
+        }
+        std::ofstream(shards_filename) << count << "\n";
+    }
 };
 
 #endif //LOCAL_STORAGE_STORAGE_H
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "log.h"
+
+#include <chrono>
+#include <cstring>
+
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace NRpc {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Bare io_uring instance driven through the raw syscalls. Submission queue
+// entries are prepared with get_sqe() and handed to the kernel in one go by
+// submit_and_wait(), which also reaps completions: one syscall per loop
+// iteration regardless of how many sockets were served.
+class Uring
+{
+private:
+    int fd = -1;
+
+    void* sq_ring = nullptr;
+    size_t sq_ring_size = 0;
+    void* cq_ring = nullptr;
+    size_t cq_ring_size = 0;
+    struct io_uring_sqe* sqes = nullptr;
+    size_t sqes_size = 0;
+
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned sq_mask = 0;
+    unsigned sq_entries = 0;
+
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    struct io_uring_cqe* cqes = nullptr;
+    unsigned cq_mask = 0;
+
+    // entries prepared by get_sqe() but not yet passed to the kernel
+    unsigned local_tail = 0;
+    unsigned to_submit = 0;
+
+public:
+    Uring() = default;
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    ~Uring()
+    {
+        if (sqes) {
+            munmap(sqes, sqes_size);
+        }
+        if (cq_ring) {
+            munmap(cq_ring, cq_ring_size);
+        }
+        if (sq_ring) {
+            munmap(sq_ring, sq_ring_size);
+        }
+        if (fd != -1) {
+            close(fd);
+        }
+    }
+
+    // Returns false if the kernel lacks io_uring or the features relied on.
+    bool init(unsigned entries)
+    {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        fd = syscall(__NR_io_uring_setup, entries, &params);
+        if (fd == -1) {
+            LOG_PERROR("io_uring_setup failed");
+            return false;
+        }
+
+        const unsigned required = IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+        if ((params.features & required) != required) {
+            LOG_ERROR("io_uring lacks NODROP or EXT_ARG");
+            return false;
+        }
+
+        sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+        sq_ring = map(sq_ring_size, IORING_OFF_SQ_RING);
+        cq_ring = map(cq_ring_size, IORING_OFF_CQ_RING);
+        sqes = static_cast<struct io_uring_sqe*>(map(sqes_size, IORING_OFF_SQES));
+        if (!sq_ring || !cq_ring || !sqes) {
+            return false;
+        }
+
+        auto* sq = static_cast<char*>(sq_ring);
+        sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries = params.sq_entries;
+        local_tail = *sq_tail;
+
+        auto* cq = static_cast<char*>(cq_ring);
+        cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+        cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+
+        return true;
+    }
+
+    // A zeroed entry to fill in, nullptr if the submission queue is full.
+    struct io_uring_sqe* get_sqe()
+    {
+        if (local_tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+            return nullptr;
+        }
+
+        const unsigned index = local_tail & sq_mask;
+        auto* sqe = &sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sq_array[index] = index;
+        ++local_tail;
+        ++to_submit;
+        return sqe;
+    }
+
+    // Submits the prepared entries and waits for at least `wait_nr`
+    // completions or the timeout, whichever comes first.
+    bool submit_and_wait(unsigned wait_nr, std::chrono::milliseconds timeout)
+    {
+        __atomic_store_n(sq_tail, local_tail, __ATOMIC_RELEASE);
+
+        struct __kernel_timespec ts;
+        ts.tv_sec = timeout.count() / 1000;
+        ts.tv_nsec = (timeout.count() % 1000) * 1000000;
+
+        struct io_uring_getevents_arg arg;
+        memset(&arg, 0, sizeof(arg));
+        arg.ts = reinterpret_cast<__u64>(&ts);
+
+        const auto ret = syscall(
+            __NR_io_uring_enter,
+            fd,
+            to_submit,
+            wait_nr,
+            IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+            &arg,
+            sizeof(arg));
+
+        if (ret == -1) {
+            if (errno == ETIME || errno == EINTR) {
+                return true;
+            }
+
+            LOG_PERROR("io_uring_enter failed");
+            return false;
+        }
+
+        to_submit -= ret;
+        return true;
+    }
+
+    // Calls f for every available completion and consumes them.
+    template <typename F>
+    void for_each_completion(F f)
+    {
+        unsigned head = *cq_head;
+        const unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            f(cqes[head & cq_mask]);
+        }
+        __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+
+private:
+    void* map(size_t size, off_t offset)
+    {
+        void* data = mmap(
+            nullptr,
+            size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            fd,
+            offset);
+
+        if (data == MAP_FAILED) {
+            LOG_PERROR("io_uring mmap failed");
+            return nullptr;
+        }
+
+        return data;
+    }
+};
+
+}   // namespace NRpc
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace NRpc {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Threads for work that may block, such as reads that miss the page cache,
+// so that it never runs on an event loop. Every worker has its own queue and
+// tasks are spread over them round-robin; an idle worker steals from the back
+// of the others' queues, so a few slow tasks don't hold back the ones queued
+// behind them.
+//
+// The pool is bounded: reserve() fails once max_queued tasks are waiting and
+// the caller is expected to do the work itself.
+class WorkerPool
+{
+public:
+    using Task = std::function<void()>;
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    const size_t max_queued;
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    // reserved tasks, counted before they are pushed
+    std::atomic<size_t> queued = 0;
+    std::atomic<size_t> next_queue = 0;
+
+    std::mutex idle_mutex;
+    std::condition_variable idle;
+    bool stopping = false;
+
+public:
+    WorkerPool(size_t thread_count, size_t max_queued)
+        : max_queued(max_queued)
+    {
+        for (size_t i = 0; i < thread_count; ++i) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+
+        for (size_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Runs the tasks still queued before returning.
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(idle_mutex);
+            stopping = true;
+        }
+        idle.notify_all();
+
+        for (auto& thread: threads) {
+            thread.join();
+        }
+    }
+
+    // Takes a place in the queues for one submit(). Fails if the pool has
+    // no threads or is full.
+    bool reserve()
+    {
+        if (queues.empty()) {
+            return false;
+        }
+
+        if (queued.fetch_add(1, std::memory_order_relaxed) >= max_queued) {
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        return true;
+    }
+
+    // Must follow a successful reserve().
+    void submit(Task task)
+    {
+        auto& queue = *queues[
+            next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size()];
+        {
+            std::lock_guard<std::mutex> guard(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        // taking the mutex orders the push before the check of a worker
+        // about to wait
+        {
+            std::lock_guard<std::mutex> guard(idle_mutex);
+        }
+        idle.notify_one();
+    }
+
+    // Tasks reserved and not yet started.
+    size_t pending() const
+    {
+        return queued.load(std::memory_order_relaxed);
+    }
+
+private:
+    void work(size_t id)
+    {
+        while (true) {
+            Task task;
+            if (pop(id, &task)) {
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> guard(idle_mutex);
+            if (stopping && pending() == 0) {
+                return;
+            }
+            idle.wait(guard, [&] { return stopping || pending() > 0; });
+            if (stopping && pending() == 0) {
+                return;
+            }
+        }
+    }
+
+    // Own queue first, oldest task first; then the newest task of another.
+    bool pop(size_t id, Task* task)
+    {
+        for (size_t i = 0; i < queues.size(); ++i) {
+            auto& queue = *queues[(id + i) % queues.size()];
+            std::lock_guard<std::mutex> guard(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+
+            if (i == 0) {
+                *task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            } else {
+                *task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+};
+
+}   // namespace NRpc